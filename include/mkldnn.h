@@ -360,6 +360,99 @@ mkldnn_status_t MKLDNN_API mkldnn_post_ops_get_params_eltwise(
         const_mkldnn_post_ops_t post_ops, int index, float *scale,
         mkldnn_alg_kind_t *alg, float *alpha, float *beta);
 
+/// Appends a depthwise convolution post operation with a 3x3 kernel, stride 1,
+/// and padding 1 to the @p post_ops. It may only follow a 1x1 convolution,
+/// whose output it takes as its source; all the shapes are deduced from that
+/// convolution.
+///
+/// The kind of this post operation is #mkldnn_convolution.
+///
+/// The depthwise convolution gets its own weights and bias (if
+/// @p bias_data_type is not #mkldnn_data_type_undef), passed at execution
+/// time as #MKLDNN_ARG_ATTR_POST_OP_DW | #MKLDNN_ARG_WEIGHTS and
+/// #MKLDNN_ARG_ATTR_POST_OP_DW | #MKLDNN_ARG_BIAS. Their memory descriptors
+/// can be queried from the convolution primitive descriptor with
+/// #mkldnn_query_weights_md and indices 2 and 3 respectively. The destination
+/// of the fused primitive has the @p dst_data_type data type, while the data
+/// type of the convolution destination descriptor is the one of the
+/// intermediate tensor, which is never written to memory.
+///
+/// The post operations preceding this one apply to the 1x1 convolution, and
+/// the ones following it apply to the depthwise convolution. The @p count,
+/// @p mask, and @p scales parameters are the depthwise convolution output
+/// scales (@sa mkldnn_primitive_attr_set_output_scales).
+mkldnn_status_t MKLDNN_API mkldnn_post_ops_append_dw_k3s1p1(
+        mkldnn_post_ops_t post_ops, mkldnn_data_type_t weights_data_type,
+        mkldnn_data_type_t bias_data_type, mkldnn_data_type_t dst_data_type,
+        mkldnn_dim_t count, int mask, const float *scales);
+
+/// Gets the parameters of the depthwise convolution post operation with index
+/// @p index in the sequence of @p post_ops.
+///
+/// @note
+///      The @p scales points to the internal storage of @p post_ops and is
+///      only valid while @p post_ops is alive and not modified.
+mkldnn_status_t MKLDNN_API mkldnn_post_ops_get_params_dw_k3s1p1(
+        const_mkldnn_post_ops_t post_ops, int index,
+        mkldnn_data_type_t *weights_data_type,
+        mkldnn_data_type_t *bias_data_type, mkldnn_data_type_t *dst_data_type,
+        mkldnn_dim_t *count, int *mask, const float **scales);
+
+/// Appends a scale and shift post operation to the @p post_ops:
+/// dst[:, c, ...] <- scales[c] * dst[:, c, ...] + shifts[c], e.g. a batch
+/// normalization folded into the preceding primitive.
+///
+/// The kind of this post operation is #mkldnn_batch_normalization.
+///
+/// The @p mask is either 0, with a single scale and shift (@p count is 1),
+/// or 1 << 1, with one scale and shift per channel of the destination
+/// (@p count is the number of channels). The @p shifts may be NULL, in which
+/// case they are zero.
+mkldnn_status_t MKLDNN_API mkldnn_post_ops_append_scale_shift(
+        mkldnn_post_ops_t post_ops, mkldnn_dim_t count, int mask,
+        const float *scales, const float *shifts);
+
+/// Gets the parameters of the scale and shift post operation with index
+/// @p index in the sequence of @p post_ops.
+///
+/// @note
+///      The @p scales and @p shifts point to the internal storage of
+///      @p post_ops and are only valid while @p post_ops is alive and not
+///      modified.
+mkldnn_status_t MKLDNN_API mkldnn_post_ops_get_params_scale_shift(
+        const_mkldnn_post_ops_t post_ops, int index, mkldnn_dim_t *count,
+        int *mask, const float **scales, const float **shifts);
+
+/// Appends a binary post operation to the @p post_ops:
+/// dst[] <- binary_op(dst[], src1[]), where binary_op is one of
+/// #mkldnn_binary_add, #mkldnn_binary_mul, #mkldnn_binary_max, and
+/// #mkldnn_binary_min (@sa mkldnn_binary_desc_init).
+///
+/// The kind of this post operation is #mkldnn_binary.
+///
+/// The second operand described by @p src1_desc either has the dimensions
+/// of the destination, or is broadcast along all the dimensions except the
+/// channel one, or along all of them. It is passed at execution time as
+/// #MKLDNN_ARG_ATTR_MULTIPLE_POST_OP(index) | #MKLDNN_ARG_SRC_1, where
+/// index is the position of this post operation in the sequence.
+///
+/// This feature might improve performance for cases like residual learning
+/// blocks when the destination of the primitive is not the tensor to be
+/// accumulated to (@sa mkldnn_post_ops_append_sum).
+mkldnn_status_t MKLDNN_API mkldnn_post_ops_append_binary(
+        mkldnn_post_ops_t post_ops, mkldnn_alg_kind_t alg,
+        const mkldnn_memory_desc_t *src1_desc);
+
+/// Gets the parameters of the binary post operation with index @p index in
+/// the sequence of @p post_ops.
+///
+/// @note
+///      The @p src1_desc points to the internal storage of @p post_ops and
+///      is only valid while @p post_ops is alive and not modified.
+mkldnn_status_t MKLDNN_API mkldnn_post_ops_get_params_binary(
+        const_mkldnn_post_ops_t post_ops, int index, mkldnn_alg_kind_t *alg,
+        const mkldnn_memory_desc_t **src1_desc);
+
 /// @}
 
 /// @}
@@ -1068,6 +1161,44 @@ mkldnn_status_t MKLDNN_API mkldnn_softmax_backward_desc_init(
 
 /// @}
 
+/// @addtogroup c_api_logsoftmax LogSoftmax
+/// A primitive to perform logsoftmax: dst = src - max(src) - log(sum(exp(src -
+/// max(src)))) along the axis, computed without the intermediate softmax so
+/// that small probabilities do not underflow.
+///
+/// @sa @ref c_api_softmax
+/// @sa @ref cpp_api_logsoftmax in @ref cpp_api
+/// @{
+
+/// Initializes a @p logsoftmax_desc for forward propagation using @p
+/// prop_kind (possible values are #mkldnn_forward_training and
+/// #mkldnn_forward_inference) and memory descriptor @p data_desc.
+///
+/// Inputs:
+///  - src (#mkldnn_query_src_md, 0)
+///
+/// Outputs:
+///  - dst (#mkldnn_query_dst_md, 0)
+mkldnn_status_t MKLDNN_API mkldnn_logsoftmax_forward_desc_init(
+        mkldnn_logsoftmax_desc_t *logsoftmax_desc, mkldnn_prop_kind_t prop_kind,
+        const mkldnn_memory_desc_t *data_desc, int logsoftmax_axis);
+
+/// Initializes a @p logsoftmax_desc for backward propagation using memory
+/// descriptors @p diff_desc and @p data_desc.
+///
+/// Inputs:
+///  - dst (#mkldnn_query_dst_md, 0)
+///  - diff_dst (#mkldnn_query_diff_dst_md, 0)
+///
+/// Outputs:
+///  - diff_src (#mkldnn_query_diff_src_md, 0)
+mkldnn_status_t MKLDNN_API mkldnn_logsoftmax_backward_desc_init(
+        mkldnn_logsoftmax_desc_t *logsoftmax_desc,
+        const mkldnn_memory_desc_t *diff_desc,
+        const mkldnn_memory_desc_t *data_desc, int logsoftmax_axis);
+
+/// @}
+
 /// @addtogroup c_api_pooling Pooling
 /// A primitive to perform max or average pooling.
 ///
@@ -1790,6 +1921,37 @@ mkldnn_status_t MKLDNN_API mkldnn_lbr_gru_backward_desc_init(
 
 /// @}
 
+/// @addtogroup c_api_binary Binary
+/// A primitive to perform elementwise binary operations with broadcasting.
+///
+/// @sa @ref cpp_api_binary in @ref cpp_api
+/// @{
+
+/// Initializes a @p binary_desc using @p alg_kind (possible values are
+/// #mkldnn_binary_add, #mkldnn_binary_mul, #mkldnn_binary_max, and
+/// #mkldnn_binary_min) and memory descriptors @p src0_desc, @p src1_desc, and
+/// @p dst_desc.
+///
+/// Each dimension of @p src1_desc must either be equal to the corresponding
+/// dimension of @p src0_desc or be 1, in which case src1 is broadcast along
+/// it. The dimensions of @p dst_desc must match those of @p src0_desc. The
+/// format of @p dst_desc may be #mkldnn_format_tag_any, in which case the
+/// format of @p src0_desc is used.
+///
+/// Inputs:
+///  - src0 (#mkldnn_query_src_md, 0)
+///  - src1 (#mkldnn_query_src_md, 1)
+///
+/// Outputs:
+///  - dst (#mkldnn_query_dst_md, 0)
+mkldnn_status_t MKLDNN_API mkldnn_binary_desc_init(
+        mkldnn_binary_desc_t *binary_desc, mkldnn_alg_kind_t alg_kind,
+        const mkldnn_memory_desc_t *src0_desc,
+        const mkldnn_memory_desc_t *src1_desc,
+        const mkldnn_memory_desc_t *dst_desc);
+
+/// @}
+
 /// @}
 
 /// @addtogroup c_api_engine Engine operations
@@ -1882,6 +2044,27 @@ mkldnn_status_t MKLDNN_API mkldnn_set_verbose(int level);
 ///     This setting overrides the MKLDNN_JIT_DUMP environment variable.
 mkldnn_status_t MKLDNN_API mkldnn_set_jit_dump(int enable);
 
+/// Sets the @p capacity of the primitive cache, i.e. the maximum number of
+/// primitives kept alive by the library for reuse. When the cache holds a
+/// primitive matching a primitive descriptor passed to
+/// mkldnn_primitive_create(), the cached primitive is returned instead of
+/// creating (and JIT-compiling) a new one. The capacity of 0 disables the
+/// cache.
+///
+/// @note
+///     This setting overrides the MKLDNN_PRIMITIVE_CACHE_CAPACITY environment
+///     variable. Reducing the capacity evicts the least recently used
+///     primitives.
+mkldnn_status_t MKLDNN_API mkldnn_set_primitive_cache_capacity(int capacity);
+
+/// Returns the @p capacity of the primitive cache.
+mkldnn_status_t MKLDNN_API mkldnn_get_primitive_cache_capacity(int *capacity);
+
+/// Returns the number of primitive cache @p hits and @p misses since the
+/// library was loaded.
+mkldnn_status_t MKLDNN_API mkldnn_get_primitive_cache_stats(
+        mkldnn_dim_t *hits, mkldnn_dim_t *misses);
+
 /// Gets library version information.
 /// Version information includes:
 ///  - major -- major version number
@@ -1965,6 +2148,27 @@ mkldnn_status_t MKLDNN_API mkldnn_gemm_s8s8s32(
         const int8_t *B, const mkldnn_dim_t *ldb, const int8_t *bo,
         const float *beta,
         int32_t *c, const mkldnn_dim_t *ldc, const int32_t *co);
+
+/// gemm_bf16bf16f32 performs the same operation as mkldnn_sgemm() with A and
+/// B in bfloat16 and C in single precision:
+///
+/// C := alpha*op( A )*op( B ) + beta*C
+///
+/// The bfloat16 values are passed as their raw 16-bit encodings (the upper
+/// half of the corresponding IEEE single-precision value). The products are
+/// accumulated in single precision.
+///
+/// @note
+///      The API is different compared with the standard BLAS routine
+///      because it returns mkldnn_status_t for error handling.
+///      XERBLA is not supported: no error message will be printed
+///      in case of incorrect parameters.
+mkldnn_status_t MKLDNN_API mkldnn_gemm_bf16bf16f32(
+        const char *transa, const char *transb,
+        const mkldnn_dim_t *M, const mkldnn_dim_t *N, const mkldnn_dim_t *K,
+        const float *alpha, const uint16_t *A, const mkldnn_dim_t *lda,
+        const uint16_t *B, const mkldnn_dim_t *ldb,
+        const float *beta, float *C, const mkldnn_dim_t *ldc);
 /// @}
 
 /// @}
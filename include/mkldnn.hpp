@@ -207,6 +207,10 @@ public:
         inner_product = mkldnn_inner_product,
         /// A rnn primitive.
         rnn = mkldnn_rnn,
+        /// A binary primitive.
+        binary = mkldnn_binary,
+        /// A logsoftmax primitive.
+        logsoftmax = mkldnn_logsoftmax,
     };
 
     primitive(const_mkldnn_primitive_desc_t c_pd);
@@ -311,6 +315,8 @@ enum class algorithm {
     eltwise_soft_relu = mkldnn_eltwise_soft_relu,
     /// Eltwise: logistic
     eltwise_logistic = mkldnn_eltwise_logistic,
+    /// Eltwise: exponent
+    eltwise_exp = mkldnn_eltwise_exp,
     /// Local response normalization (LRN) across multiple channels
     lrn_across_channels = mkldnn_lrn_across_channels,
     /// LRN within a single channel
@@ -338,6 +344,14 @@ enum class algorithm {
     /// Primitive expects 4 biases on input:
     /// \f$[b_{u}, b_{r}, b_{c_x}, b_{c_h}]\f$
     lbr_gru = mkldnn_lbr_gru,
+    /// Binary add
+    binary_add = mkldnn_binary_add,
+    /// Binary mul
+    binary_mul = mkldnn_binary_mul,
+    /// Binary max
+    binary_max = mkldnn_binary_max,
+    /// Binary min
+    binary_min = mkldnn_binary_min,
 };
 
 inline mkldnn_alg_kind_t convert_to_c(algorithm aalgorithm) {
@@ -513,6 +527,10 @@ enum class query {
     inner_product_d = mkldnn_query_inner_product_d,
     /// rnn descriptor
     rnn_d = mkldnn_query_rnn_d,
+    /// binary descriptor
+    binary_d = mkldnn_query_binary_d,
+    /// logsoftmax descriptor
+    logsoftmax_d = mkldnn_query_logsoftmax_d,
 
     /// source memory desc
     src_md = mkldnn_query_src_md,
@@ -630,6 +648,111 @@ struct post_ops: public handle<mkldnn_post_ops_t> {
                 "could not get eltwise params");
         alg = static_cast<algorithm>(c_alg);
     }
+
+    /// Appends a depthwise convolution post operation with a 3x3 kernel,
+    /// stride 1, and padding 1. It may only follow a 1x1 convolution.
+    ///
+    /// The kind of this post operation is #mkldnn_convolution.
+    ///
+    /// The weights and bias of the depthwise convolution are passed at
+    /// execution time as #MKLDNN_ARG_ATTR_POST_OP_DW | #MKLDNN_ARG_WEIGHTS and
+    /// #MKLDNN_ARG_ATTR_POST_OP_DW | #MKLDNN_ARG_BIAS; their descriptors are
+    /// the convolution primitive descriptor weights_md with indices 2 and 3.
+    /// The @p mask and @p scales are the depthwise convolution output scales.
+    /// The data types are given as #mkldnn_data_type_t values.
+    ///
+    /// @sa mkldnn_post_ops_append_dw_k3s1p1
+    void append_dw_k3s1p1(mkldnn_data_type_t weights_data_type,
+            mkldnn_data_type_t bias_data_type,
+            mkldnn_data_type_t dst_data_type, int mask,
+            const std::vector<float> &scales) {
+        error::wrap_c_api(mkldnn_post_ops_append_dw_k3s1p1(get(),
+                    weights_data_type, bias_data_type, dst_data_type,
+                    (mkldnn_dim_t)scales.size(), mask, &scales[0]),
+                "could not append depthwise convolution");
+    }
+
+    /// Gets the parameters of the depthwise convolution post operation with
+    /// index @p index.
+    void get_params_dw_k3s1p1(int index,
+            mkldnn_data_type_t &weights_data_type,
+            mkldnn_data_type_t &bias_data_type,
+            mkldnn_data_type_t &dst_data_type, int &mask,
+            std::vector<float> &scales) const {
+        mkldnn_dim_t count;
+        int c_mask;
+        const float *c_scales;
+        error::wrap_c_api(mkldnn_post_ops_get_params_dw_k3s1p1(get(), index,
+                    &weights_data_type, &bias_data_type, &dst_data_type,
+                    &count, &c_mask, &c_scales),
+                "could not get depthwise convolution params");
+        mask = c_mask;
+        scales.assign(c_scales, c_scales + count);
+    }
+
+    /// Appends a scale and shift post operation:
+    /// dst[:, c, ...] <- scales[c] * dst[:, c, ...] + shifts[c].
+    ///
+    /// The kind of this post operation is #mkldnn_batch_normalization.
+    ///
+    /// The @p mask is either 0, with a single scale and shift, or 1 << 1,
+    /// with one scale and shift per channel. An empty @p shifts means zero
+    /// shifts.
+    ///
+    /// @sa mkldnn_post_ops_append_scale_shift
+    void append_scale_shift(int mask, const std::vector<float> &scales,
+            const std::vector<float> &shifts = std::vector<float>()) {
+        error::wrap_c_api(shifts.empty() || shifts.size() == scales.size()
+                    ? mkldnn_success : mkldnn_invalid_arguments,
+                "scales and shifts sizes mismatch");
+        error::wrap_c_api(mkldnn_post_ops_append_scale_shift(get(),
+                    (mkldnn_dim_t)scales.size(), mask, &scales[0],
+                    shifts.empty() ? nullptr : &shifts[0]),
+                "could not append scale and shift");
+    }
+
+    /// Gets the parameters of the scale and shift post operation with index
+    /// @p index.
+    void get_params_scale_shift(int index, int &mask,
+            std::vector<float> &scales, std::vector<float> &shifts) const {
+        mkldnn_dim_t count;
+        int c_mask;
+        const float *c_scales, *c_shifts;
+        error::wrap_c_api(mkldnn_post_ops_get_params_scale_shift(get(), index,
+                    &count, &c_mask, &c_scales, &c_shifts),
+                "could not get scale and shift params");
+        mask = c_mask;
+        scales.assign(c_scales, c_scales + count);
+        shifts.assign(c_shifts, c_shifts + count);
+    }
+
+    /// Appends a binary post operation: dst[] <- alg(dst[], src1[]).
+    ///
+    /// The kind of this post operation is #mkldnn_binary.
+    ///
+    /// The second operand, described by @p src1_desc (e.g. the data of a
+    /// memory::desc), is passed at execution time as
+    /// #MKLDNN_ARG_ATTR_MULTIPLE_POST_OP(index) | #MKLDNN_ARG_SRC_1, where
+    /// index is the position of this post operation in the sequence.
+    ///
+    /// @sa mkldnn_post_ops_append_binary
+    void append_binary(algorithm alg, const mkldnn_memory_desc_t &src1_desc) {
+        error::wrap_c_api(mkldnn_post_ops_append_binary(get(),
+                    convert_to_c(alg), &src1_desc),
+                "could not append binary");
+    }
+
+    /// Gets the parameters of the binary post operation with index @p index.
+    void get_params_binary(int index, algorithm &alg,
+            mkldnn_memory_desc_t &src1_desc) const {
+        mkldnn_alg_kind_t c_alg;
+        const mkldnn_memory_desc_t *c_src1_desc;
+        error::wrap_c_api(mkldnn_post_ops_get_params_binary(get(), index,
+                    &c_alg, &c_src1_desc),
+                "could not get binary params");
+        alg = static_cast<algorithm>(c_alg);
+        src1_desc = *c_src1_desc;
+    }
 };
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -905,6 +1028,10 @@ struct stream: public handle<mkldnn_stream_t> {
         out_of_order = mkldnn_stream_out_of_order,
         /// Default stream configuration.
         default_flags = mkldnn_stream_default_flags,
+        /// Asynchronous execution on a CPU engine: primitive::execute()
+        /// only enqueues the primitive and stream::wait() waits for the
+        /// completion. See #mkldnn_stream_async.
+        async = mkldnn_stream_async,
     };
 
     stream() = default;
@@ -3210,6 +3337,111 @@ struct softmax_backward : public primitive {
 
 /// @}
 
+/// @addtogroup cpp_api_logsoftmax LogSoftmax
+/// A primitive to perform logsoftmax.
+///
+/// @sa @ref c_api_logsoftmax in @ref c_api
+/// @{
+
+/// LogSoftmax for forward propagation.  Implements descriptor, primitive
+/// descriptor, and primitive.
+struct logsoftmax_forward : public primitive {
+
+    /// Descriptor for logsoftmax forward propagation.
+    struct desc {
+        mkldnn_logsoftmax_desc_t data;
+
+        /// Initializes a logsoftmax descriptor for forward propagation using
+        /// @p prop_kind (possible values are #mkldnn::forward_training and
+        /// #mkldnn::forward_inference) and memory descriptor @p data_desc.
+        desc(prop_kind aprop_kind, const memory::desc &data_desc,
+             int logsoftmax_axis) {
+            error::wrap_c_api(mkldnn_logsoftmax_forward_desc_init(&data,
+                    mkldnn::convert_to_c(aprop_kind), &data_desc.data,
+                    logsoftmax_axis),
+                "could not create a logsoftmax forward descriptor");
+        }
+    };
+
+    /// Primitive descriptor for logsoftmax forward propagation.
+    struct primitive_desc : public mkldnn::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(const desc &desc, const engine &e)
+            : mkldnn::primitive_desc(&desc.data, nullptr, e, nullptr) {}
+
+        primitive_desc(const desc &desc, const primitive_attr &attr, const engine &e)
+            : mkldnn::primitive_desc(&desc.data, &attr, e, nullptr) {}
+
+        /// Queries source memory descriptor.
+        memory::desc src_desc() const {
+            return query_md(query::src_md, 0);
+        }
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const {
+            return query_md(query::dst_md, 0);
+        }
+    };
+
+    logsoftmax_forward() = default;
+
+    logsoftmax_forward(const primitive_desc &pd): primitive(pd) {}
+};
+
+/// LogSoftmax for backward propagation.  Implements descriptor, primitive
+/// descriptor, and primitive.
+struct logsoftmax_backward : public primitive {
+
+    /// Descriptor for logsoftmax backward propagation.
+    struct desc {
+        mkldnn_logsoftmax_desc_t data;
+
+        /// Initializes a logsoftmax descriptor for backward propagation using
+        /// memory descriptors @p diff_desc and @p data_desc.
+        desc(const memory::desc &diff_desc, const memory::desc &data_desc,
+                int logsoftmax_axis) {
+            error::wrap_c_api(mkldnn_logsoftmax_backward_desc_init(&data,
+                        &diff_desc.data, &data_desc.data, logsoftmax_axis),
+                    "could not init a backward logsoftmax descriptor");
+        }
+    };
+
+    /// Primitive descriptor for logsoftmax backward propagation.
+    struct primitive_desc : public mkldnn::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(const desc &desc, const engine &e,
+                const logsoftmax_forward::primitive_desc &hint_fwd_pd)
+            : mkldnn::primitive_desc(&desc.data, nullptr, e, hint_fwd_pd.get()) {}
+
+        primitive_desc(const desc &desc, const primitive_attr &attr, const engine &e,
+                const logsoftmax_forward::primitive_desc &hint_fwd_pd)
+            : mkldnn::primitive_desc(&desc.data, &attr, e, hint_fwd_pd.get()) {}
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const {
+            return query_md(query::dst_md, 0);
+        }
+
+        /// Queries diff source memory descriptor.
+        memory::desc diff_src_desc() const {
+            return query_md(query::diff_src_md, 0);
+        }
+
+        /// Queries diff destination memory descriptor.
+        memory::desc diff_dst_desc() const {
+            return query_md(query::diff_dst_md, 0);
+        }
+    };
+
+    logsoftmax_backward() = default;
+
+    logsoftmax_backward(const primitive_desc &pd): primitive(pd) {}
+};
+
+/// @}
+
 /// @addtogroup cpp_api_batch_normalization Batch normalization
 /// A primitive to perform batch normalization.
 ///
@@ -4747,8 +4979,97 @@ struct shuffle_backward : public primitive {
 
 /// @}
 
+/// @addtogroup cpp_api_binary Binary
+/// A primitive to perform elementwise binary operations with broadcasting.
+///
+/// @sa @ref c_api_binary in @ref c_api
+/// @{
+
+/// Elementwise binary operation. Implements descriptor, primitive
+/// descriptor, and primitive.
+struct binary : public primitive {
+
+    /// Descriptor for a binary operation.
+    struct desc {
+        mkldnn_binary_desc_t data;
+
+        /// Initializes a binary descriptor using @p algorithm (possible
+        /// values are #mkldnn::binary_add, #mkldnn::binary_mul,
+        /// #mkldnn::binary_max, and #mkldnn::binary_min) and memory
+        /// descriptors @p src0, @p src1, and @p dst. The dimensions of
+        /// @p src1 must either match those of @p src0 or be equal to 1.
+        desc(algorithm aalgorithm, const memory::desc &src0,
+                const memory::desc &src1, const memory::desc &dst) {
+            error::wrap_c_api(mkldnn_binary_desc_init(&data,
+                        mkldnn::convert_to_c(aalgorithm), &src0.data,
+                        &src1.data, &dst.data),
+                    "could not create a binary descriptor");
+        }
+    };
+
+    /// Primitive descriptor for a binary operation.
+    struct primitive_desc : public mkldnn::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(const desc &desc, const engine &e)
+            : mkldnn::primitive_desc(&desc.data, nullptr, e, nullptr) {}
+
+        primitive_desc(const desc &desc, const primitive_attr &attr,
+                const engine &e)
+            : mkldnn::primitive_desc(&desc.data, &attr, e, nullptr) {}
+
+        /// Queries source memory descriptor @p idx (0 or 1).
+        memory::desc src_desc(int idx = 0) const {
+            return query_md(query::src_md, idx);
+        }
+
+        /// Queries the first source memory descriptor.
+        memory::desc src0_desc() const { return src_desc(0); }
+
+        /// Queries the second source memory descriptor.
+        memory::desc src1_desc() const { return src_desc(1); }
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const {
+            return query_md(query::dst_md, 0);
+        }
+    };
+
+    binary() = default;
+
+    binary(const primitive_desc &pd): primitive(pd) {}
+};
+
+/// @}
+
 /// @} Primitives
 
+/// @addtogroup cpp_api_service Service functions
+/// @{
+
+/// Sets the capacity of the primitive cache.
+/// @sa mkldnn_set_primitive_cache_capacity
+inline void set_primitive_cache_capacity(int capacity) {
+    error::wrap_c_api(mkldnn_set_primitive_cache_capacity(capacity),
+            "could not set primitive cache capacity");
+}
+
+/// Returns the capacity of the primitive cache.
+inline int get_primitive_cache_capacity() {
+    int capacity = 0;
+    error::wrap_c_api(mkldnn_get_primitive_cache_capacity(&capacity),
+            "could not get primitive cache capacity");
+    return capacity;
+}
+
+/// Returns the number of primitive cache @p hits and @p misses.
+inline void get_primitive_cache_stats(memory::dim &hits, memory::dim &misses) {
+    error::wrap_c_api(mkldnn_get_primitive_cache_stats(&hits, &misses),
+            "could not get primitive cache stats");
+}
+
+/// @}
+
 /// @} C++ API
 
 // implementation section
@@ -621,6 +621,10 @@ typedef enum {
     mkldnn_rnn,
     /// A matrix multiplication primitive.
     mkldnn_gemm,
+    /// A binary primitive.
+    mkldnn_binary,
+    /// A logsoftmax primitive.
+    mkldnn_logsoftmax,
 } mkldnn_primitive_kind_t;
 
 /// Kinds of algorithms.
@@ -656,6 +660,8 @@ typedef enum {
     mkldnn_eltwise_soft_relu = 0x9f,
     /// Eltwise: logistic
     mkldnn_eltwise_logistic = 0xaf,
+    /// Eltwise: exponent
+    mkldnn_eltwise_exp = 0xbf,
     /// Max pooling
     mkldnn_pooling_max = 0x1ff,
     /// Average pooling include padding
@@ -681,6 +687,14 @@ typedef enum {
     /// Primitive expects 4 biases on input:
     /// \f$[b_{u}, b_{r}, b_{c_x}, b_{c_h}]\f$
     mkldnn_lbr_gru = 0x4fff,
+    /// Binary add
+    mkldnn_binary_add = 0x1fff0,
+    /// Binary mul
+    mkldnn_binary_mul = 0x1fff1,
+    /// Binary max
+    mkldnn_binary_max = 0x1fff2,
+    /// Binary min
+    mkldnn_binary_min = 0x1fff3,
 } mkldnn_alg_kind_t;
 
 /// Flags for batch-normalization primitive.
@@ -977,8 +991,8 @@ typedef struct {
     /// The kind of eltwise algorithm. Possible values: #mkldnn_eltwise_relu,
     /// #mkldnn_eltwise_tanh, #mkldnn_eltwise_elu, #mkldnn_eltwise_square,
     /// #mkldnn_eltwise_abs, #mkldnn_eltwise_sqrt, #mkldnn_eltwise_linear,
-    /// #mkldnn_eltwise_bounded_relu, #mkldnn_eltwise_soft_relu, and
-    /// #mkldnn_eltwise_logistic.
+    /// #mkldnn_eltwise_bounded_relu, #mkldnn_eltwise_soft_relu,
+    /// #mkldnn_eltwise_logistic, and #mkldnn_eltwise_exp.
     mkldnn_alg_kind_t alg_kind;
     /// Source and destination memory descriptor.
     mkldnn_memory_desc_t data_desc;
@@ -996,13 +1010,14 @@ typedef struct {
     ///  - #mkldnn_eltwise_bounded_relu: @p alpha -- upper bound, @p beta ignored
     ///  - #mkldnn_eltwise_soft_relu: @p alpha and @p beta ignored
     ///  - #mkldnn_eltwise_logistic: @p alpha and @p beta ignored
+    ///  - #mkldnn_eltwise_exp: @p alpha and @p beta ignored
     float alpha, beta;
 } mkldnn_eltwise_desc_t;
 
 /// A descriptor of a Softmax operation.
 typedef struct {
     /// The kind of primitive. Used for self-identifying the primitive
-    /// descriptor. Must be #mkldnn_softmax.
+    /// descriptor. Must be #mkldnn_softmax or #mkldnn_logsoftmax.
     mkldnn_primitive_kind_t primitive_kind;
     /// The kind of propagation. Possible values: #mkldnn_forward_training and
     /// #mkldnn_forward_inference.
@@ -1015,6 +1030,10 @@ typedef struct {
     int softmax_axis;
 } mkldnn_softmax_desc_t;
 
+/// A descriptor of a LogSoftmax operation. An alias of Softmax structure, but
+/// primitive_kind must be #mkldnn_logsoftmax.
+typedef mkldnn_softmax_desc_t mkldnn_logsoftmax_desc_t;
+
 /// A descriptor of a pooling operation.
 typedef struct {
     /// The kind of primitive. Used for self-identifying the primitive
@@ -1211,6 +1230,23 @@ typedef struct {
 
 } mkldnn_rnn_desc_t;
 
+/// A descriptor of a binary operation.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #mkldnn_binary.
+    mkldnn_primitive_kind_t primitive_kind;
+    /// The kind of the binary algorithm. Possible values:
+    /// #mkldnn_binary_add, #mkldnn_binary_mul, #mkldnn_binary_max, and
+    /// #mkldnn_binary_min.
+    mkldnn_alg_kind_t alg_kind;
+    /// Source memory descriptors. The dimensions of the second source must
+    /// either match the dimensions of the first one or be equal to 1, in
+    /// which case the second source is broadcast along them.
+    mkldnn_memory_desc_t src_desc[2];
+    /// Destination memory descriptor.
+    mkldnn_memory_desc_t dst_desc;
+} mkldnn_binary_desc_t;
+
 /// @}
 
 /// @addtogroup c_api_engine_types Engine
@@ -1397,6 +1433,20 @@ typedef const struct mkldnn_primitive *const_mkldnn_primitive_t;
 #define MKLDNN_ARG_MULTIPLE_SRC         1024
 #define MKLDNN_ARG_MULTIPLE_DST         2048
 
+/// Starting index for the arguments of the depthwise convolution post
+/// operation, e.g. MKLDNN_ARG_ATTR_POST_OP_DW | MKLDNN_ARG_WEIGHTS
+#define MKLDNN_ARG_ATTR_POST_OP_DW      8192
+
+/// Starting index for the arguments of the post operations that take
+/// their own inputs, e.g. MKLDNN_ARG_ATTR_MULTIPLE_POST_OP(1) |
+/// MKLDNN_ARG_SRC_1 for the second operand of a binary post operation
+/// with index 1
+#define MKLDNN_ARG_ATTR_MULTIPLE_POST_OP_BASE 16384
+
+/// Arguments of the post operation with index @p idx
+#define MKLDNN_ARG_ATTR_MULTIPLE_POST_OP(idx) \
+    (MKLDNN_ARG_ATTR_MULTIPLE_POST_OP_BASE * ((idx) + 1))
+
 /// @}
 
 /// An auxiliary structure to specify primitive's inputs/outputs at execution
@@ -1477,6 +1527,8 @@ typedef enum {
     mkldnn_query_inner_product_d, ///< inner product descriptor
     mkldnn_query_rnn_d, ///< rnn descriptor
     mkldnn_query_gemm_d, ///< GEMM descriptor
+    mkldnn_query_binary_d, ///< binary descriptor
+    mkldnn_query_logsoftmax_d, ///< logsoftmax descriptor
 
     // memory descriptor section
     mkldnn_query_some_md = 128, ///< stub
@@ -1506,6 +1558,13 @@ typedef enum {
     mkldnn_stream_out_of_order = 0x4U,
     /// Default stream configuration.
     mkldnn_stream_default_flags = mkldnn_stream_default_order,
+    /// Asynchronous execution (CPU engines only), combined with the default
+    /// configuration. mkldnn_primitive_execute() enqueues the primitive and
+    /// returns immediately, and a worker thread of the stream executes the
+    /// primitives in their submission order. The memory objects passed to
+    /// a primitive must stay alive until mkldnn_stream_wait() returns,
+    /// which also reports the first execution error.
+    mkldnn_stream_async = 0x8U,
 } mkldnn_stream_flags_t;
 
 /// @struct mkldnn_stream
@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include "mkldnn.h"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl::status;
+using namespace mkldnn::impl::alg_kind;
+
+status_t mkldnn_binary_desc_init(binary_desc_t *binary_desc,
+        alg_kind_t alg_kind, const memory_desc_t *src0_desc,
+        const memory_desc_t *src1_desc, const memory_desc_t *dst_desc) {
+    bool args_ok = true
+        && !any_null(binary_desc, src0_desc, src1_desc, dst_desc)
+        && one_of(alg_kind, binary_add, binary_mul, binary_max, binary_min);
+    if (!args_ok) return invalid_arguments;
+
+    const int ndims = src0_desc->ndims;
+    bool consistency = true
+        && ndims > 0
+        && src1_desc->ndims == ndims
+        && dst_desc->ndims == ndims;
+    for (int d = 0; d < ndims && consistency; ++d)
+        consistency = true
+            && one_of(src1_desc->dims[d], 1, src0_desc->dims[d])
+            && dst_desc->dims[d] == src0_desc->dims[d];
+    if (!consistency) return invalid_arguments;
+
+    auto bd = binary_desc_t();
+    bd.primitive_kind = primitive_kind::binary;
+    bd.alg_kind = alg_kind;
+    bd.src_desc[0] = *src0_desc;
+    bd.src_desc[1] = *src1_desc;
+    bd.dst_desc = *dst_desc;
+
+    *binary_desc = bd;
+    return success;
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
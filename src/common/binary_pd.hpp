@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef BINARY_PD_HPP
+#define BINARY_PD_HPP
+
+#include <assert.h>
+
+#include "mkldnn.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace mkldnn {
+namespace impl {
+
+struct binary_pd_t: public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::binary;
+
+    typedef binary_pd_t base_class;
+    typedef binary_pd_t hint_class;
+
+    binary_pd_t(engine_t *engine,
+            const binary_desc_t *adesc,
+            const primitive_attr_t *attr,
+            const binary_pd_t *hint_fwd_pd)
+        : primitive_desc_t(engine, attr, base_pkind)
+        , desc_(*adesc)
+        , src0_md_(desc_.src_desc[0])
+        , src1_md_(desc_.src_desc[1])
+        , dst_md_(desc_.dst_desc)
+    {}
+
+    const binary_desc_t *desc() const { return &desc_; }
+    virtual const op_desc_t *op_desc() const override
+    { return reinterpret_cast<const op_desc_t *>(this->desc()); }
+    virtual void init_info() override { impl::init_info(this, this->info_); }
+
+    virtual status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+        case query::binary_d:
+            *(const binary_desc_t**)result = desc(); break;
+        default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    virtual arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, MKLDNN_ARG_SRC_0, MKLDNN_ARG_SRC_1))
+            return arg_usage_t::input;
+
+        if (arg == MKLDNN_ARG_DST)
+            return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    virtual const memory_desc_t *src_md(int index = 0) const override {
+        if (index == 0) return &src0_md_;
+        if (index == 1) return &src1_md_;
+        return nullptr;
+    }
+    virtual const memory_desc_t *dst_md(int index = 0) const override
+    { return index == 0 ? &dst_md_ : nullptr; }
+
+    virtual int n_inputs() const override { return 2; }
+    virtual int n_outputs() const override { return 1; }
+
+    /* binary aux functions */
+
+    int ndims() const { return dst_md_.ndims; }
+    alg_kind_t alg_kind() const { return desc_.alg_kind; }
+
+    /* true if src1 is broadcast along dimension d */
+    bool is_broadcast_dim(int d) const
+    { return src1_md_.dims[d] != src0_md_.dims[d]; }
+
+    /* true if src1 has the same dimensions as src0 */
+    bool is_tensor_op() const {
+        for (int d = 0; d < ndims(); ++d)
+            if (is_broadcast_dim(d)) return false;
+        return true;
+    }
+
+protected:
+    binary_desc_t desc_;
+
+    memory_desc_t src0_md_;
+    memory_desc_t src1_md_;
+    memory_desc_t dst_md_;
+
+    /* dst and src1 with format `any` inherit the layout of src0; src1 dims
+     * equal to 1 simply collapse the corresponding blocks */
+    status_t set_default_params() {
+        if (src0_md_.format_kind == format_kind::any) {
+            if (dst_md_.format_kind == format_kind::blocked)
+                CHECK(memory_desc_init_by_blocking_desc(src0_md_,
+                            dst_md_.format_desc.blocking));
+            else
+                CHECK(memory_desc_init_by_strides(src0_md_, nullptr));
+        }
+        if (src0_md_.format_kind != format_kind::blocked)
+            return status::unimplemented;
+
+        const auto &src0_blk = src0_md_.format_desc.blocking;
+        if (dst_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_blocking_desc(dst_md_, src0_blk));
+        if (src1_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_blocking_desc(src1_md_, src0_blk));
+
+        return status::success;
+    }
+};
+
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
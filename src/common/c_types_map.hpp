@@ -74,6 +74,7 @@ namespace alg_kind {
     const alg_kind_t eltwise_bounded_relu = mkldnn_eltwise_bounded_relu;
     const alg_kind_t eltwise_soft_relu = mkldnn_eltwise_soft_relu;
     const alg_kind_t eltwise_logistic = mkldnn_eltwise_logistic;
+    const alg_kind_t eltwise_exp = mkldnn_eltwise_exp;
     const alg_kind_t pooling_max = mkldnn_pooling_max;
     const alg_kind_t pooling_avg = mkldnn_pooling_avg;
     const alg_kind_t pooling_avg_include_padding = mkldnn_pooling_avg_include_padding;
@@ -84,6 +85,10 @@ namespace alg_kind {
     const alg_kind_t vanilla_lstm = mkldnn_vanilla_lstm;
     const alg_kind_t vanilla_gru = mkldnn_vanilla_gru;
     const alg_kind_t lbr_gru = mkldnn_lbr_gru;
+    const alg_kind_t binary_add = mkldnn_binary_add;
+    const alg_kind_t binary_mul = mkldnn_binary_mul;
+    const alg_kind_t binary_max = mkldnn_binary_max;
+    const alg_kind_t binary_min = mkldnn_binary_min;
 }
 
 using data_type_t = mkldnn_data_type_t;
@@ -430,6 +435,8 @@ namespace primitive_kind {
     const primitive_kind_t inner_product = mkldnn_inner_product;
     const primitive_kind_t rnn = mkldnn_rnn;
     const primitive_kind_t gemm = mkldnn_gemm;
+    const primitive_kind_t binary = mkldnn_binary;
+    const primitive_kind_t logsoftmax = mkldnn_logsoftmax;
 }
 
 using query_t = mkldnn_query_t;
@@ -462,6 +469,8 @@ namespace query {
     const query_t inner_product_d = mkldnn_query_inner_product_d;
     const query_t rnn_d = mkldnn_query_rnn_d;
     const query_t gemm_d = mkldnn_query_gemm_d;
+    const query_t binary_d = mkldnn_query_binary_d;
+    const query_t logsoftmax_d = mkldnn_query_logsoftmax_d;
 
     const query_t some_md = mkldnn_query_some_md;
     const query_t src_md = mkldnn_query_src_md;
@@ -486,12 +495,14 @@ using shuffle_desc_t = mkldnn_shuffle_desc_t;
 using pooling_desc_t = mkldnn_pooling_desc_t;
 using eltwise_desc_t = mkldnn_eltwise_desc_t;
 using softmax_desc_t = mkldnn_softmax_desc_t;
+using logsoftmax_desc_t = mkldnn_logsoftmax_desc_t;
 using lrn_desc_t = mkldnn_lrn_desc_t;
 using batch_normalization_desc_t = mkldnn_batch_normalization_desc_t;
 using inner_product_desc_t = mkldnn_inner_product_desc_t;
 
 using rnn_direction_t = mkldnn_rnn_direction_t;
 using rnn_desc_t = mkldnn_rnn_desc_t;
+using binary_desc_t = mkldnn_binary_desc_t;
 
 /* Internal type, declared in gemm_types.hpp */
 using gemm_desc_t = mkldnn_gemm_desc_t;
@@ -509,11 +520,13 @@ struct op_desc_t {
         pooling_desc_t pooling;
         eltwise_desc_t eltwise;
         softmax_desc_t softmax;
+        logsoftmax_desc_t logsoftmax;
         lrn_desc_t lrn;
         batch_normalization_desc_t batch_normalization;
         inner_product_desc_t inner_product;
         rnn_desc_t rnn;
         gemm_desc_t gemm;
+        binary_desc_t binary;
     };
 
     op_desc_t(const primitive_kind_t &_): kind(_) {}
@@ -535,6 +548,7 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(inner_product_desc_t, inner_product);
     DECL_CTOR_AND_CONVERTERS(rnn_desc_t, rnn);
     DECL_CTOR_AND_CONVERTERS(gemm_desc_t, gemm);
+    DECL_CTOR_AND_CONVERTERS(binary_desc_t, binary);
 
 #   undef DECL_CTOR_AND_CONVERTERS
 };
@@ -553,6 +567,7 @@ namespace stream_flags {
     const stream_flags_t in_order = mkldnn_stream_in_order;
     const stream_flags_t out_of_order = mkldnn_stream_out_of_order;
     const stream_flags_t default_flags = mkldnn_stream_default_flags;
+    const stream_flags_t async = mkldnn_stream_async;
 }
 using stream_t = mkldnn_stream;
 
@@ -560,6 +575,7 @@ using stream_t = mkldnn_stream;
 struct batch_normalization_bwd_pd_t;
 struct batch_normalization_fwd_pd_t;
 struct batch_normalization_pd_t;
+struct binary_pd_t;
 struct concat_pd_t;
 struct convolution_bwd_data_pd_t;
 struct convolution_bwd_weights_pd_t;
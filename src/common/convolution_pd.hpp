@@ -215,7 +215,8 @@ struct convolution_fwd_pd_t: public convolution_pd_t {
         return nullptr;
     }
 
-    virtual int n_inputs() const override { return 2 + with_bias(); }
+    virtual int n_inputs() const override
+    { return 2 + with_bias() + n_binary_po_inputs(); }
     virtual int n_outputs() const override { return 1; }
 
 protected:
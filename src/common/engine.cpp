@@ -19,6 +19,7 @@
 #include "mkldnn.h"
 #include "engine.hpp"
 #include "nstl.hpp"
+#include "primitive_cache.hpp"
 
 #include "c_types_map.hpp"
 #include "utils.hpp"
@@ -109,6 +110,7 @@ status_t mkldnn_engine_get_backend_kind(
 
 status_t mkldnn_engine_destroy(engine_t *engine) {
     /* TODO: engine->dec_ref_count(); */
+    if (engine != nullptr) primitive_cache().evict(engine);
     delete engine;
     return success;
 }
@@ -245,11 +245,22 @@ inline U logistic_bwd(T dd, T s) {
     return dd * v * (1 - v);
 }
 
+template <typename T, typename U = typename utils::remove_reference<T>::type>
+inline U exp_fwd(T s) {
+    return (U)(::expf((float)s));
+}
+
+template <typename T, typename U = typename utils::remove_reference<T>::type>
+inline U exp_bwd(T dd, T s) {
+    return (U)(dd * ::expf((float)s));
+}
+
 inline bool eltwise_fwd_preserves_zero(alg_kind_t alg, bool jit_impl = false) {
     using namespace alg_kind;
     using namespace utils;
     const bool preserves_zero = true
-        && !one_of(alg, eltwise_linear, eltwise_soft_relu, eltwise_logistic)
+        && !one_of(alg, eltwise_linear, eltwise_soft_relu, eltwise_logistic,
+                eltwise_exp)
         && IMPLICATION(jit_impl, !one_of(alg, eltwise_elu, eltwise_tanh));
     return preserves_zero;
 }
@@ -267,6 +278,7 @@ inline float get_bias(const char *bias, size_t offset, data_type_t data_type)
     CASE(data_type::u8);
     CASE(data_type::s32);
     CASE(data_type::f32);
+    CASE(data_type::bf16);
     default: assert(!"unimplemented");
     }
     return 0; // never happens (should probably be a NaN)
@@ -18,7 +18,8 @@
 #define MEMORY_TRACKING_HPP
 
 #include <assert.h>
-#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "nstl.hpp"
 #include "utils.hpp"
@@ -56,7 +57,10 @@ namespace memory_tracking {
  *                   alignment for each piece. This class is also responsible
  *                   for computing the right offset to a given piece using the
  *                   base pointer.
- *                   This class is basically a ledger with all entries.
+ *                   This class is basically a ledger with all entries. The
+ *                   entries booked without a prefix are stored in a flat
+ *                   table indexed by the key (see `names`), hence the keys
+ *                   should stay small and dense.
  *                   Lives in primitive descriptors.
  *
  * 2. registrar_t -- the interface to a registry_t to book memory. Used at
@@ -144,6 +148,7 @@ namespace memory_tracking {
 namespace names {
 enum {
     key_none = 0,
+    key_binary_bcast,
     key_bnorm_tmp_mean,
     key_bnorm_tmp_var,
     key_bnorm_tmp_diff_ss,
@@ -167,6 +172,7 @@ enum {
     key_conv_wei_reduction,
     key_conv_wei_bia_reduction,
     key_conv_wei_bia_reduction_bctx,
+    key_fusion_inout_buffer,
     key_iprod_int_dat_in_acc_dt,
     key_reducer_space,
     key_reducer_space_bctx,
@@ -218,23 +224,32 @@ struct grantor_t;
 struct registry_t {
     void book(const key_t &key, size_t size, size_t alignment) {
         if (size == 0) return;
-        assert(offset_map_.count(key) == 0);
+        assert(find(key) == nullptr);
 
         size = utils::rnd_up(size, minimal_alignment);
         alignment = nstl::max<size_t>(alignment, minimal_alignment);
-        offset_map_[key] = entry_t{size_, size, alignment};
+        const entry_t e = {size_, size, alignment};
+
+        if (key < MAX_KEY) {
+            if (key >= entries_.size()) entries_.resize(key + 1, entry_t());
+            entries_[key] = e;
+        } else {
+            prefixed_entries_.push_back(std::make_pair(key, e));
+        }
 
         size_ += size + alignment - minimal_alignment;
     }
 
     void *get(const key_t &key, void *base_ptr) const {
         if (base_ptr == nullptr) { assert(size() == 0); return nullptr; }
-        if (offset_map_.count(key) != 1) return nullptr;
 
-        const auto &e = offset_map_.at(key);
+        const entry_t *e = find(key);
+        if (e == nullptr) return nullptr;
+
         base_ptr = utils::align_ptr<void>(base_ptr, minimal_alignment);
-        char *ptr = (char *)base_ptr + e.offset;
-        return utils::align_ptr<void>(ptr, e.alignment);
+        char *ptr = (char *)base_ptr + e->offset;
+        return e->alignment == minimal_alignment
+            ? ptr : utils::align_ptr<void>(ptr, e->alignment);
     }
 
     size_t size() const
@@ -247,7 +262,24 @@ protected:
     enum { minimal_alignment = 64 };
     struct entry_t { size_t offset, size, alignment; };
 
-    std::unordered_map<key_t, entry_t> offset_map_;
+    const entry_t *find(const key_t &key) const {
+        if (key < MAX_KEY) {
+            if (key >= entries_.size() || entries_[key].size == 0)
+                return nullptr;
+            return &entries_[key];
+        }
+
+        /* only auxiliary pieces (e.g. reducers) use prefixed keys, and
+         * there are just a few of them */
+        for (const auto &ke: prefixed_entries_)
+            if (ke.first == key) return &ke.second;
+        return nullptr;
+    }
+
+    /* entries with no prefix are indexed by the key directly, so that
+     * getting a piece at execution time costs one array access */
+    std::vector<entry_t> entries_;
+    std::vector<std::pair<key_t, entry_t>> prefixed_entries_;
     size_t size_ = 0;
 };
 
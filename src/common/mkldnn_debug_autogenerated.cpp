@@ -354,6 +354,8 @@ const char *mkldnn_prim_kind2str(mkldnn_primitive_kind_t v) {
     if (v == mkldnn_inner_product) return "inner_product";
     if (v == mkldnn_rnn) return "rnn";
     if (v == mkldnn_gemm) return "gemm";
+    if (v == mkldnn_binary) return "binary";
+    if (v == mkldnn_logsoftmax) return "logsoftmax";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
 }
@@ -375,6 +377,7 @@ const char *mkldnn_alg_kind2str(mkldnn_alg_kind_t v) {
     if (v == mkldnn_eltwise_bounded_relu) return "eltwise_bounded_relu";
     if (v == mkldnn_eltwise_soft_relu) return "eltwise_soft_relu";
     if (v == mkldnn_eltwise_logistic) return "eltwise_logistic";
+    if (v == mkldnn_eltwise_exp) return "eltwise_exp";
     if (v == mkldnn_pooling_max) return "pooling_max";
     if (v == mkldnn_pooling_avg_include_padding) return "pooling_avg_include_padding";
     if (v == mkldnn_pooling_avg_exclude_padding) return "pooling_avg_exclude_padding";
@@ -385,6 +388,10 @@ const char *mkldnn_alg_kind2str(mkldnn_alg_kind_t v) {
     if (v == mkldnn_vanilla_lstm) return "vanilla_lstm";
     if (v == mkldnn_vanilla_gru) return "vanilla_gru";
     if (v == mkldnn_lbr_gru) return "lbr_gru";
+    if (v == mkldnn_binary_add) return "binary_add";
+    if (v == mkldnn_binary_mul) return "binary_mul";
+    if (v == mkldnn_binary_max) return "binary_max";
+    if (v == mkldnn_binary_min) return "binary_min";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
 }
@@ -76,6 +76,8 @@ PKIND_TRAITS_INST(batch_normalization);
 PKIND_TRAITS_INST(inner_product);
 PKIND_TRAITS_INST(rnn);
 PKIND_TRAITS_INST(gemm);
+PKIND_TRAITS_INST(binary);
+PKIND_TRAITS_INST(logsoftmax);
 #undef PKIND_TRAITS_INST
 
 }
@@ -18,6 +18,7 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "primitive_cache.hpp"
 #include "primitive_desc.hpp"
 #include "primitive.hpp"
 #include "type_helpers.hpp"
@@ -54,23 +55,16 @@ status_t mkldnn_primitive_create(primitive_t **primitive,
         const primitive_desc_t *primitive_desc) {
     if (utils::any_null(primitive, primitive_desc))
         return invalid_arguments;
-    return primitive_desc->create_primitive(primitive);
+    return primitive_cache().create(primitive, primitive_desc);
 }
 
-status_t mkldnn_primitive_execute(const primitive_t *primitive,
-        stream_t *stream, int nargs, const mkldnn_exec_arg_t *c_args) {
-    bool ok = true
-        && !utils::any_null(primitive, stream)
-        && primitive->engine() == stream->engine()
-        && IMPLICATION(nargs > 0, c_args != nullptr);
-    if (!ok) return invalid_arguments;
+status_t mkldnn::impl::primitive_execute(const primitive_t *primitive,
+        const exec_ctx_t &ctx) {
+    auto stream = ctx.stream();
 
-    exec_args_t args;
-    status_t status = cvt_primtive_args(primitive->pd(), nargs, c_args, args);
+    status_t status = primitive->prepare_exec(ctx);
     if (status != status::success) return status;
 
-    exec_ctx_t ctx(stream, std::move(args));
-
     const int gpu_exec_time_level = 4;
     if (mkldnn_verbose()->level) {
         double ms = get_msec();
@@ -81,9 +75,11 @@ status_t mkldnn_primitive_execute(const primitive_t *primitive,
                 && mkldnn_verbose()->level < gpu_exec_time_level) {
             printf("mkldnn_verbose,exec,%s\n", primitive->pd()->info());
         } else {
-            // GPU engines require synchronization to measure actual time
-            // For CPU engines wait() is no-op
-            stream->wait();
+            // GPU engines require synchronization to measure actual time.
+            // CPU execution is synchronous at this point, even on an
+            // asynchronous stream, whose worker thread is the caller here.
+            if (stream->engine()->kind() == engine_kind::gpu)
+                stream->wait();
             ms = get_msec() - ms;
         }
 
@@ -103,6 +99,23 @@ status_t mkldnn_primitive_execute(const primitive_t *primitive,
     return status;
 }
 
+status_t mkldnn_primitive_execute(const primitive_t *primitive,
+        stream_t *stream, int nargs, const mkldnn_exec_arg_t *c_args) {
+    bool ok = true
+        && !utils::any_null(primitive, stream)
+        && primitive->engine() == stream->engine()
+        && IMPLICATION(nargs > 0, c_args != nullptr);
+    if (!ok) return invalid_arguments;
+
+    exec_args_t args;
+    status_t status = cvt_primtive_args(primitive->pd(), nargs, c_args, args);
+    if (status != status::success) return status;
+
+    exec_ctx_t ctx(stream, std::move(args));
+
+    return stream->enqueue_primitive(primitive, ctx);
+}
+
 status_t mkldnn_primitive_get_primitive_desc(const primitive_t *primitive,
         const primitive_desc_t **primitive_desc) {
     if (utils::any_null(primitive, primitive_desc))
@@ -113,7 +126,7 @@ status_t mkldnn_primitive_get_primitive_desc(const primitive_t *primitive,
 
 status_t mkldnn_primitive_destroy(primitive_t *primitive) {
     if (primitive != nullptr)
-        delete primitive;
+        primitive->release();
     return success;
 }
 
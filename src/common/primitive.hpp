@@ -46,11 +46,18 @@
  */
 struct mkldnn_primitive: public mkldnn::impl::c_compatible {
     mkldnn_primitive(const mkldnn::impl::primitive_desc_t *pd)
-        : pd_(pd->clone()) {}
+        : pd_(pd->clone()), counter_(1) {}
     virtual ~mkldnn_primitive() { delete pd_; }
 
     virtual mkldnn::impl::status_t init() { return mkldnn::impl::status::success; }
 
+    /** primitives may be shared (e.g. by the primitive cache), hence are
+     * reference counted: the last release() destroys the primitive */
+    void retain() { mkldnn::impl::fetch_and_add(&counter_, 1); }
+    void release() {
+        if (mkldnn::impl::fetch_and_add(&counter_, -1) == 1) delete this;
+    }
+
     /** returns primitive's engine */
     mkldnn::impl::engine_t *engine() const { return pd_->engine(); }
     /** returns primitive's inputs */
@@ -58,6 +65,13 @@ struct mkldnn_primitive: public mkldnn::impl::c_compatible {
     /** returns primitive's kind */
     mkldnn::impl::primitive_kind_t kind() const { return pd_->kind(); }
 
+    /** acquires the resources the execution with context @p ctx needs
+     * (e.g. a scratchpad from the stream), called before execute() */
+    virtual mkldnn::impl::status_t prepare_exec(
+            const mkldnn::impl::exec_ctx_t &ctx) const {
+        return mkldnn::impl::status::success;
+    }
+
     /** executes primitive with execution context @p ctx */
     virtual mkldnn::impl::status_t execute(const mkldnn::impl::exec_ctx_t &ctx)
         const = 0;
@@ -66,6 +80,8 @@ protected:
     const mkldnn::impl::primitive_desc_t *pd_;
 
 private:
+    int32_t counter_;
+
     mkldnn_primitive() = delete;
     mkldnn_primitive(const mkldnn_primitive &) = delete;
     mkldnn_primitive(mkldnn_primitive &&) = delete;
@@ -73,6 +89,17 @@ private:
     mkldnn_primitive &operator=(mkldnn_primitive &&) = delete;
 };
 
+namespace mkldnn {
+namespace impl {
+
+/** executes @p primitive with @p ctx on the calling thread, the way
+ * mkldnn_primitive_execute() would on a synchronous stream */
+status_t primitive_execute(const primitive_t *primitive,
+        const exec_ctx_t &ctx);
+
+}
+}
+
 #endif
 
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -38,7 +38,7 @@ status_t scales_t::set(dim_t count, int mask, const float *scales) {
         scales_ = scales_buf_;
         utils::array_set(scales_, scales[0], scales_buf_size);
     } else {
-        scales_ = (float *)impl::malloc(count_ * sizeof(*scales_), 64);
+        scales_ = (float *)mkldnn::impl::malloc(count_ * sizeof(*scales_), 64);
         if (scales_ == nullptr)
             return status::out_of_memory;
 
@@ -53,9 +53,7 @@ status_t scales_t::set(dim_t count, int mask, const float *scales) {
 }
 
 status_t post_ops_t::append_sum(float scale) {
-    if (len_ == capacity)
-        return out_of_memory;
-
+    entry_.push_back(entry_t());
     entry_[len_].kind = primitive_kind::sum;
     entry_[len_].sum.scale = scale;
 
@@ -69,13 +67,12 @@ status_t post_ops_t::append_eltwise(float scale, alg_kind_t alg, float alpha,
     using namespace mkldnn::impl::alg_kind;
     bool known_alg = one_of(alg, eltwise_relu, eltwise_tanh, eltwise_elu,
             eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_linear,
-            eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic);
+            eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic,
+            eltwise_exp);
     if (!known_alg)
         return invalid_arguments;
 
-    if (len_ == capacity)
-        return out_of_memory;
-
+    entry_.push_back(entry_t());
     entry_[len_].kind = primitive_kind::eltwise;
     entry_[len_].eltwise.scale = scale;
     entry_[len_].eltwise.alg = alg;
@@ -87,6 +84,113 @@ status_t post_ops_t::append_eltwise(float scale, alg_kind_t alg, float alpha,
     return success;
 }
 
+status_t post_ops_t::entry_t::set_depthwise_scales(const float *scales) {
+    auto &dw = depthwise_conv;
+    dw.scales = (float *)mkldnn::impl::malloc(dw.count * sizeof(*dw.scales), 64);
+    if (dw.scales == nullptr)
+        return out_of_memory;
+
+    utils::array_copy(dw.scales, scales, dw.count);
+    return success;
+}
+
+status_t post_ops_t::append_dw_k3s1p1(data_type_t wei_dt, data_type_t bias_dt,
+        data_type_t dst_dt, dim_t count, int mask, const float *scales) {
+    using namespace data_type;
+    bool ok = true
+        && one_of(wei_dt, f32, s8)
+        && one_of(bias_dt, undef, f32, s32, s8, u8)
+        && one_of(dst_dt, f32, s32, s8, u8)
+        && count > 0
+        && mask >= 0;
+    if (!ok)
+        return invalid_arguments;
+
+    entry_.push_back(entry_t());
+    auto &e = entry_[len_];
+    e.kind = primitive_kind::convolution;
+    e.depthwise_conv.wei_dt = wei_dt;
+    e.depthwise_conv.bias_dt = bias_dt;
+    e.depthwise_conv.dst_dt = dst_dt;
+    e.depthwise_conv.count = count;
+    e.depthwise_conv.mask = mask;
+    e.depthwise_conv.scales = nullptr;
+    status_t status = e.set_depthwise_scales(scales);
+    if (status != success) {
+        e = post_ops_t::entry_t();
+        entry_.resize(len_);
+        return status;
+    }
+
+    len_++;
+
+    return success;
+}
+
+status_t post_ops_t::entry_t::set_scale_shift(const float *scales,
+        const float *shifts) {
+    auto &ss = scale_shift;
+    ss.scales = (float *)mkldnn::impl::malloc(
+            2 * ss.count * sizeof(*ss.scales), 64);
+    if (ss.scales == nullptr)
+        return out_of_memory;
+    ss.shifts = ss.scales + ss.count;
+
+    utils::array_copy(ss.scales, scales, ss.count);
+    if (shifts)
+        utils::array_copy(ss.shifts, shifts, ss.count);
+    else
+        utils::array_set(ss.shifts, 0.f, ss.count);
+    return success;
+}
+
+status_t post_ops_t::append_scale_shift(dim_t count, int mask,
+        const float *scales, const float *shifts) {
+    bool ok = count > 0 && one_of(mask, 0, 1 << 1)
+        && IMPLICATION(mask == 0, count == 1);
+    if (!ok)
+        return invalid_arguments;
+
+    entry_.push_back(entry_t());
+    auto &e = entry_[len_];
+    e.kind = primitive_kind::batch_normalization;
+    e.scale_shift.count = count;
+    e.scale_shift.mask = mask;
+    e.scale_shift.scales = e.scale_shift.shifts = nullptr;
+    status_t status = e.set_scale_shift(scales, shifts);
+    if (status != success) {
+        e = post_ops_t::entry_t();
+        entry_.resize(len_);
+        return status;
+    }
+
+    len_++;
+
+    return success;
+}
+
+status_t post_ops_t::append_binary(alg_kind_t alg,
+        const memory_desc_t *src1_desc) {
+    using namespace alg_kind;
+    using namespace data_type;
+    bool ok = one_of(alg, binary_add, binary_mul, binary_max, binary_min)
+        && one_of(src1_desc->data_type, f32, s8, u8)
+        && src1_desc->ndims > 0
+        && !types::is_zero_md(src1_desc)
+        && src1_desc->format_kind == format_kind::blocked;
+    if (!ok)
+        return invalid_arguments;
+
+    entry_.push_back(entry_t());
+    entry_[len_].kind = primitive_kind::binary;
+    entry_[len_].binary.alg = alg;
+    entry_[len_].binary.src1_desc = *src1_desc;
+
+    len_++;
+
+    return success;
+}
+
 status_t primitive_attr_t::set_scratchpad_mode(
         scratchpad_mode_t scratchpad_mode) {
     using namespace mkldnn::impl::scratchpad_mode;
@@ -272,6 +376,90 @@ status_t mkldnn_post_ops_get_params_eltwise(const post_ops_t *post_ops,
     return success;
 }
 
+status_t mkldnn_post_ops_append_dw_k3s1p1(post_ops_t *post_ops,
+        data_type_t weights_data_type, data_type_t bias_data_type,
+        data_type_t dst_data_type, dim_t count, int mask,
+        const float *scales) {
+    if (any_null(post_ops, scales))
+        return invalid_arguments;
+
+    return post_ops->append_dw_k3s1p1(weights_data_type, bias_data_type,
+            dst_data_type, count, mask, scales);
+}
+
+status_t mkldnn_post_ops_get_params_dw_k3s1p1(const post_ops_t *post_ops,
+        int index, data_type_t *weights_data_type,
+        data_type_t *bias_data_type, data_type_t *dst_data_type,
+        dim_t *count, int *mask, const float **scales) {
+    bool ok = true
+        && simple_get_params_check(post_ops, index,
+                primitive_kind::convolution)
+        && !any_null(weights_data_type, bias_data_type, dst_data_type,
+                count, mask, scales);
+    if (!ok)
+        return invalid_arguments;
+
+    const auto &dw = post_ops->entry_[index].depthwise_conv;
+    *weights_data_type = dw.wei_dt;
+    *bias_data_type = dw.bias_dt;
+    *dst_data_type = dw.dst_dt;
+    *count = dw.count;
+    *mask = dw.mask;
+    *scales = dw.scales;
+
+    return success;
+}
+
+status_t mkldnn_post_ops_append_scale_shift(post_ops_t *post_ops, dim_t count,
+        int mask, const float *scales, const float *shifts) {
+    if (any_null(post_ops, scales))
+        return invalid_arguments;
+
+    return post_ops->append_scale_shift(count, mask, scales, shifts);
+}
+
+status_t mkldnn_post_ops_get_params_scale_shift(const post_ops_t *post_ops,
+        int index, dim_t *count, int *mask, const float **scales,
+        const float **shifts) {
+    bool ok = true
+        && simple_get_params_check(post_ops, index,
+                primitive_kind::batch_normalization)
+        && !any_null(count, mask, scales, shifts);
+    if (!ok)
+        return invalid_arguments;
+
+    const auto &ss = post_ops->entry_[index].scale_shift;
+    *count = ss.count;
+    *mask = ss.mask;
+    *scales = ss.scales;
+    *shifts = ss.shifts;
+
+    return success;
+}
+
+status_t mkldnn_post_ops_append_binary(post_ops_t *post_ops, alg_kind_t alg,
+        const memory_desc_t *src1_desc) {
+    if (any_null(post_ops, src1_desc))
+        return invalid_arguments;
+
+    return post_ops->append_binary(alg, src1_desc);
+}
+
+status_t mkldnn_post_ops_get_params_binary(const post_ops_t *post_ops,
+        int index, alg_kind_t *alg, const memory_desc_t **src1_desc) {
+    bool ok = true
+        && simple_get_params_check(post_ops, index, primitive_kind::binary)
+        && !any_null(alg, src1_desc);
+    if (!ok)
+        return invalid_arguments;
+
+    const auto &b = post_ops->entry_[index].binary;
+    *alg = b.alg;
+    *src1_desc = &b.src1_desc;
+
+    return success;
+}
+
 status_t mkldnn_primitive_attr_set_rnn_data_qparams(
         primitive_attr_t *attr, const float scale, const float shift) {
     if (attr == nullptr)
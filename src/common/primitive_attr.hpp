@@ -21,6 +21,7 @@
 
 #include "c_types_map.hpp"
 #include "nstl.hpp"
+#include "type_helpers.hpp"
 #include "utils.hpp"
 
 namespace mkldnn {
@@ -30,6 +31,9 @@ struct rnn_data_qparams_t : public c_compatible {
     rnn_data_qparams_t() : scale_(1.), shift_(0.) {}
     bool has_default_values() const { return (scale_ == 1. && shift_ == 0.); }
 
+    bool operator==(const rnn_data_qparams_t &rhs) const
+    { return scale_ == rhs.scale_ && shift_ == rhs.shift_; }
+
     status_t set(float scale, float shift) {
         scale_ = scale;
         shift_ = shift;
@@ -65,6 +69,13 @@ struct scales_t: public c_compatible {
         return true;
     }
 
+    bool operator==(const scales_t &rhs) const {
+        bool ret = count_ == rhs.count_ && mask_ == rhs.mask_;
+        for (dim_t c = 0; ret && c < count_; ++c)
+            ret = scales_[c] == rhs.scales_[c];
+        return ret;
+    }
+
     status_t set(dim_t count, int mask, const float *scales);
     status_t set(float single_scale) { return this->set(1, 0, &single_scale); }
 
@@ -96,10 +107,55 @@ struct mkldnn_post_ops: public mkldnn::impl::c_compatible {
             float scale, alpha, beta;
         };
 
+        /* 3x3 depthwise convolution, stride 1, padding 1, applied to the
+         * output of a 1x1 convolution; the shapes follow from the 1x1 one */
+        struct depthwise_conv_t {
+            mkldnn::impl::data_type_t wei_dt;
+            mkldnn::impl::data_type_t bias_dt;
+            mkldnn::impl::data_type_t dst_dt;
+            mkldnn::impl::dim_t count;
+            int mask;
+            float *scales;
+        };
+
+        /* per-channel (mask 1 << 1) or common (mask 0) dst = scale * dst +
+         * shift, e.g. a batch normalization folded into the convolution;
+         * shifts points right after the count scales of the same buffer */
+        struct scale_shift_t {
+            mkldnn::impl::dim_t count;
+            int mask;
+            float *scales;
+            float *shifts;
+        };
+
+        /* dst = alg(dst, src1) with src1 passed at execution time as
+         * MKLDNN_ARG_ATTR_MULTIPLE_POST_OP(idx) | MKLDNN_ARG_SRC_1 */
+        struct binary_t {
+            mkldnn::impl::alg_kind_t alg;
+            mkldnn::impl::memory_desc_t src1_desc;
+        };
+
+        entry_t(): kind(mkldnn::impl::primitive_kind::undefined) {}
+        entry_t(const entry_t &rhs)
+            : kind(mkldnn::impl::primitive_kind::undefined)
+        { copy_from(rhs); }
+
+        ~entry_t() { clear(); }
+
+        entry_t &operator=(const entry_t &rhs) {
+            if (&rhs == this) return *this;
+            clear();
+            copy_from(rhs);
+            return *this;
+        }
+
         mkldnn::impl::primitive_kind_t kind;
         union {
             struct { float scale; } sum;
             eltwise_t eltwise;
+            depthwise_conv_t depthwise_conv;
+            scale_shift_t scale_shift;
+            binary_t binary;
         };
 
         bool is_eltwise(bool require_scale_one = true) const {
@@ -121,6 +177,103 @@ struct mkldnn_post_ops: public mkldnn::impl::c_compatible {
             return kind == primitive_kind::sum
                 && IMPLICATION(require_scale_one, sum.scale == 1.f);
         }
+
+        bool is_depthwise_conv() const {
+            using namespace mkldnn::impl;
+            return kind == primitive_kind::convolution;
+        }
+
+        bool is_scale_shift() const {
+            using namespace mkldnn::impl;
+            return kind == primitive_kind::batch_normalization;
+        }
+
+        bool is_binary() const {
+            using namespace mkldnn::impl;
+            return kind == primitive_kind::binary;
+        }
+
+        bool operator==(const entry_t &rhs) const {
+            using namespace mkldnn::impl;
+            if (kind != rhs.kind) return false;
+            switch (kind) {
+            case primitive_kind::sum: return sum.scale == rhs.sum.scale;
+            case primitive_kind::eltwise:
+                return eltwise.alg == rhs.eltwise.alg
+                    && eltwise.scale == rhs.eltwise.scale
+                    && eltwise.alpha == rhs.eltwise.alpha
+                    && eltwise.beta == rhs.eltwise.beta;
+            case primitive_kind::convolution: {
+                const auto &dw = depthwise_conv, &rdw = rhs.depthwise_conv;
+                bool ret = dw.wei_dt == rdw.wei_dt
+                    && dw.bias_dt == rdw.bias_dt
+                    && dw.dst_dt == rdw.dst_dt
+                    && dw.count == rdw.count
+                    && dw.mask == rdw.mask;
+                for (dim_t c = 0; ret && c < dw.count; ++c)
+                    ret = dw.scales[c] == rdw.scales[c];
+                return ret;
+            }
+            case primitive_kind::batch_normalization: {
+                const auto &ss = scale_shift, &rss = rhs.scale_shift;
+                bool ret = ss.count == rss.count && ss.mask == rss.mask;
+                for (dim_t c = 0; ret && c < ss.count; ++c)
+                    ret = ss.scales[c] == rss.scales[c]
+                        && ss.shifts[c] == rss.shifts[c];
+                return ret;
+            }
+            case primitive_kind::binary:
+                return binary.alg == rhs.binary.alg
+                    && binary.src1_desc == rhs.binary.src1_desc;
+            default: return false;
+            }
+        }
+
+        mkldnn::impl::status_t set_depthwise_scales(const float *scales);
+        mkldnn::impl::status_t set_scale_shift(const float *scales,
+                const float *shifts);
+
+    private:
+        void clear() {
+            if (is_depthwise_conv()) {
+                mkldnn::impl::free(depthwise_conv.scales);
+                depthwise_conv.scales = nullptr;
+            }
+            if (is_scale_shift()) {
+                mkldnn::impl::free(scale_shift.scales);
+                scale_shift.scales = scale_shift.shifts = nullptr;
+            }
+            kind = mkldnn::impl::primitive_kind::undefined;
+        }
+
+        void copy_from(const entry_t &rhs) {
+            using namespace mkldnn::impl;
+            kind = rhs.kind;
+            switch (kind) {
+            case primitive_kind::sum: sum = rhs.sum; break;
+            case primitive_kind::eltwise: eltwise = rhs.eltwise; break;
+            case primitive_kind::convolution: {
+                depthwise_conv = rhs.depthwise_conv;
+                depthwise_conv.scales = nullptr;
+                status_t status
+                    = set_depthwise_scales(rhs.depthwise_conv.scales);
+                assert(status == status::success);
+                (void)status;
+                break;
+            }
+            case primitive_kind::batch_normalization: {
+                scale_shift = rhs.scale_shift;
+                scale_shift.scales = scale_shift.shifts = nullptr;
+                status_t status = set_scale_shift(rhs.scale_shift.scales,
+                        rhs.scale_shift.shifts);
+                assert(status == status::success);
+                (void)status;
+                break;
+            }
+            case primitive_kind::binary: binary = rhs.binary; break;
+            default: break;
+            }
+        }
     };
 
     mkldnn_post_ops(): len_(0) {}
@@ -128,6 +281,15 @@ struct mkldnn_post_ops: public mkldnn::impl::c_compatible {
     mkldnn::impl::status_t append_sum(float scale);
     mkldnn::impl::status_t append_eltwise(float scale,
             mkldnn::impl::alg_kind_t alg, float alpha, float beta);
+    mkldnn::impl::status_t append_dw_k3s1p1(
+            mkldnn::impl::data_type_t wei_dt,
+            mkldnn::impl::data_type_t bias_dt,
+            mkldnn::impl::data_type_t dst_dt, mkldnn::impl::dim_t count,
+            int mask, const float *scales);
+    mkldnn::impl::status_t append_scale_shift(mkldnn::impl::dim_t count,
+            int mask, const float *scales, const float *shifts);
+    mkldnn::impl::status_t append_binary(mkldnn::impl::alg_kind_t alg,
+            const mkldnn::impl::memory_desc_t *src1_desc);
 
     int find(mkldnn::impl::primitive_kind_t kind, int start = 0,
             int stop = -1) const {
@@ -143,10 +305,15 @@ struct mkldnn_post_ops: public mkldnn::impl::c_compatible {
     bool contain(mkldnn::impl::primitive_kind_t kind, int index) const
     { return find(kind, index, index + 1) == index; }
 
-    enum { capacity = 4 };
+    bool operator==(const mkldnn_post_ops &rhs) const {
+        if (len_ != rhs.len_) return false;
+        for (int idx = 0; idx < len_; ++idx)
+            if (!(entry_[idx] == rhs.entry_[idx])) return false;
+        return true;
+    }
 
     int len_;
-    entry_t entry_[capacity];
+    mkldnn::impl::nstl::vector<entry_t> entry_;
 };
 
 struct mkldnn_primitive_attr: public mkldnn::impl::c_compatible {
@@ -168,6 +335,15 @@ struct mkldnn_primitive_attr: public mkldnn::impl::c_compatible {
             && rnn_weights_qparams_.has_default_values();
     }
 
+    bool operator==(const mkldnn_primitive_attr &rhs) const {
+        return true
+            && scratchpad_mode_ == rhs.scratchpad_mode_
+            && output_scales_ == rhs.output_scales_
+            && post_ops_ == rhs.post_ops_
+            && rnn_data_qparams_ == rhs.rnn_data_qparams_
+            && rnn_weights_qparams_ == rhs.rnn_weights_qparams_;
+    }
+
     mkldnn::impl::status_t set_scratchpad_mode(
             mkldnn::impl::scratchpad_mode_t scratchpad_mode);
     mkldnn::impl::status_t set_post_ops(
@@ -0,0 +1,222 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mkldnn.h"
+
+#include "c_types_map.hpp"
+#include "gemm_types.hpp"
+#include "mkldnn_traits.hpp"
+#include "primitive.hpp"
+#include "primitive_cache.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::status;
+
+namespace mkldnn {
+namespace impl {
+
+namespace {
+/* op descriptors are stored by the pds as the exact kind-specific type, hence
+ * only the corresponding number of bytes may be accessed */
+size_t op_desc_size(primitive_kind_t kind) {
+#   define CASE(op) \
+    case primitive_kind::op: \
+        return sizeof(typename pkind_traits<primitive_kind::op>::desc_type)
+    switch (kind) {
+    CASE(convolution);
+    CASE(deconvolution);
+    CASE(shuffle);
+    CASE(eltwise);
+    CASE(softmax);
+    CASE(pooling);
+    CASE(lrn);
+    CASE(batch_normalization);
+    CASE(inner_product);
+    CASE(rnn);
+    CASE(gemm);
+    CASE(binary);
+    CASE(logsoftmax);
+    default: return 0;
+    }
+#   undef CASE
+}
+
+/* FNV-1a */
+size_t hash_bytes(size_t seed, const void *ptr, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(ptr);
+    for (size_t i = 0; i < size; ++i) {
+        seed ^= bytes[i];
+        seed *= (size_t)1099511628211ULL;
+    }
+    return seed;
+}
+
+bool is_cacheable(const primitive_desc_t *pd) {
+    return pd->op_desc() != nullptr && op_desc_size(pd->kind()) != 0;
+}
+}
+
+primitive_hash_key_t::primitive_hash_key_t(const primitive_desc_t *pd)
+    : kind_(pd->kind()), engine_(pd->engine()), impl_name_(pd->name())
+    , attr_(*pd->attr()) {
+    const size_t op_size = op_desc_size(kind_);
+    const uint8_t *op_bytes
+        = reinterpret_cast<const uint8_t *>(pd->op_desc());
+    op_desc_.assign(op_bytes, op_bytes + op_size);
+
+    /* memory descriptors with `any` format are resolved by the pd, and may
+     * differ for the same op descriptor (e.g. because of the fwd hint) */
+    const int max_idx = 4;
+    for (int idx = 0; idx < max_idx; ++idx) {
+        for (auto md: { pd->src_md(idx), pd->diff_src_md(idx),
+                pd->weights_md(idx), pd->diff_weights_md(idx),
+                pd->dst_md(idx), pd->diff_dst_md(idx) })
+            if (md) mds_.push_back(*md);
+    }
+    if (pd->workspace_md()) mds_.push_back(*pd->workspace_md());
+    mds_.push_back(*pd->scratchpad_md());
+
+    size_t seed = (size_t)14695981039346656037ULL;
+    seed = hash_bytes(seed, &kind_, sizeof(kind_));
+    seed = hash_bytes(seed, &engine_, sizeof(engine_));
+    seed = hash_bytes(seed, impl_name_.c_str(), impl_name_.size());
+    seed = hash_bytes(seed, op_desc_.data(), op_desc_.size());
+    seed = hash_bytes(seed, &attr_.post_ops_.len_, sizeof(int));
+    hash_ = seed;
+}
+
+bool primitive_hash_key_t::operator==(const primitive_hash_key_t &rhs) const {
+    bool ret = true
+        && hash_ == rhs.hash_
+        && kind_ == rhs.kind_
+        && engine_ == rhs.engine_
+        && impl_name_ == rhs.impl_name_
+        && op_desc_ == rhs.op_desc_
+        && attr_ == rhs.attr_
+        && mds_.size() == rhs.mds_.size();
+    for (size_t i = 0; ret && i < mds_.size(); ++i)
+        ret = mds_[i] == rhs.mds_[i];
+    return ret;
+}
+
+primitive_cache_t::~primitive_cache_t() { shrink(0); }
+
+status_t primitive_cache_t::create(primitive_t **primitive,
+        const primitive_desc_t *pd) {
+    if (capacity() == 0 || !is_cacheable(pd))
+        return pd->create_primitive(primitive);
+
+    primitive_hash_key_t key(pd);
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = map_.find(key);
+        if (it != map_.end()) {
+            lru_.splice(lru_.begin(), lru_, it->second);
+            primitive_t *p = it->second->second;
+            p->retain();
+            *primitive = p;
+            ++hits_;
+            return success;
+        }
+        ++misses_;
+    }
+
+    /* primitive creation (and jitting) happens outside of the lock, so that
+     * different threads may create different primitives simultaneously */
+    status_t status = pd->create_primitive(primitive);
+    if (status != success) return status;
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (capacity_ == 0 || map_.count(key) != 0) return success;
+
+    (*primitive)->retain();
+    lru_.emplace_front(key, *primitive);
+    map_.emplace(key, lru_.begin());
+    shrink((size_t)capacity_);
+
+    return success;
+}
+
+void primitive_cache_t::evict(const engine_t *engine) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (auto it = lru_.begin(); it != lru_.end();) {
+        if (it->first.engine_ != engine) { ++it; continue; }
+        map_.erase(it->first);
+        it->second->release();
+        it = lru_.erase(it);
+    }
+}
+
+int primitive_cache_t::capacity() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return capacity_;
+}
+
+status_t primitive_cache_t::set_capacity(int capacity) {
+    if (capacity < 0) return invalid_arguments;
+    std::lock_guard<std::mutex> guard(mutex_);
+    capacity_ = capacity;
+    shrink((size_t)capacity_);
+    return success;
+}
+
+void primitive_cache_t::get_stats(dim_t *hits, dim_t *misses) const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (hits) *hits = hits_;
+    if (misses) *misses = misses_;
+}
+
+void primitive_cache_t::shrink(size_t size) {
+    while (lru_.size() > size) {
+        auto &last = lru_.back();
+        map_.erase(last.first);
+        last.second->release();
+        lru_.pop_back();
+    }
+}
+
+primitive_cache_t &primitive_cache() {
+    const int default_capacity = 200;
+    static primitive_cache_t cache(nstl::max(0,
+                getenv_int("MKLDNN_PRIMITIVE_CACHE_CAPACITY",
+                    default_capacity)));
+    return cache;
+}
+
+}
+}
+
+status_t mkldnn_set_primitive_cache_capacity(int capacity) {
+    return primitive_cache().set_capacity(capacity);
+}
+
+status_t mkldnn_get_primitive_cache_capacity(int *capacity) {
+    if (capacity == nullptr) return invalid_arguments;
+    *capacity = primitive_cache().capacity();
+    return success;
+}
+
+status_t mkldnn_get_primitive_cache_stats(dim_t *hits, dim_t *misses) {
+    if (utils::any_null(hits, misses)) return invalid_arguments;
+    primitive_cache().get_stats(hits, misses);
+    return success;
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef PRIMITIVE_CACHE_HPP
+#define PRIMITIVE_CACHE_HPP
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "primitive_attr.hpp"
+
+namespace mkldnn {
+namespace impl {
+
+/** Identifies the primitive a primitive descriptor creates.
+ *
+ * Primitive descriptors with equal keys (same engine, implementation,
+ * operation descriptor, attributes, and resolved memory descriptors) create
+ * primitives that behave identically, so one primitive can serve them all.
+ */
+struct primitive_hash_key_t {
+    primitive_hash_key_t(const primitive_desc_t *pd);
+
+    bool operator==(const primitive_hash_key_t &rhs) const;
+
+    primitive_kind_t kind_;
+    const engine_t *engine_;
+    std::string impl_name_;
+    std::vector<uint8_t> op_desc_;
+    primitive_attr_t attr_;
+    std::vector<memory_desc_t> mds_;
+    size_t hash_;
+};
+
+struct primitive_hash_key_hasher_t {
+    size_t operator()(const primitive_hash_key_t &key) const
+    { return key.hash_; }
+};
+
+/** LRU cache of primitives created via mkldnn_primitive_create().
+ *
+ * The cache holds a reference to each cached primitive, and hands out an
+ * extra reference on every hit. The capacity is initialized from the
+ * MKLDNN_PRIMITIVE_CACHE_CAPACITY environment variable; capacity 0 disables
+ * the cache. */
+struct primitive_cache_t: public c_compatible {
+    primitive_cache_t(int capacity)
+        : capacity_(capacity), hits_(0), misses_(0) {}
+    ~primitive_cache_t();
+
+    /** creates a primitive for @p pd or fetches the cached one */
+    status_t create(primitive_t **primitive, const primitive_desc_t *pd);
+
+    /** drops all the primitives that belong to @p engine */
+    void evict(const engine_t *engine);
+
+    int capacity() const;
+    status_t set_capacity(int capacity);
+
+    void get_stats(dim_t *hits, dim_t *misses) const;
+
+private:
+    typedef std::list<std::pair<primitive_hash_key_t, primitive_t *>> lru_t;
+
+    void shrink(size_t size);
+
+    int capacity_;
+    dim_t hits_, misses_;
+
+    lru_t lru_; /* the most recently used entry goes first */
+    std::unordered_map<primitive_hash_key_t, lru_t::iterator,
+        primitive_hash_key_hasher_t> map_;
+
+    mutable std::mutex mutex_;
+
+    primitive_cache_t(const primitive_cache_t &) = delete;
+    primitive_cache_t &operator=(const primitive_cache_t &) = delete;
+};
+
+primitive_cache_t &primitive_cache();
+
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
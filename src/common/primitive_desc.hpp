@@ -62,9 +62,28 @@ struct mkldnn_primitive_desc: public mkldnn::impl::c_compatible {
         using mkldnn::impl::types::is_zero_md;
         if (arg == MKLDNN_ARG_SCRATCHPAD && !is_zero_md(scratchpad_md()))
             return arg_usage_t::output;
+        if (is_binary_po_arg(arg))
+            return arg_usage_t::input;
         return arg_usage_t::unused;
     }
 
+    /** returns true if @p arg is the second operand of a binary post-op */
+    bool is_binary_po_arg(int arg) const {
+        const int base = MKLDNN_ARG_ATTR_MULTIPLE_POST_OP_BASE;
+        if (arg < base || arg % base != MKLDNN_ARG_SRC_1) return false;
+        return attr_.post_ops_.contain(mkldnn::impl::primitive_kind::binary,
+                arg / base - 1);
+    }
+
+    /** returns the number of inputs taken by the binary post-ops */
+    int n_binary_po_inputs() const {
+        const auto &p = attr_.post_ops_;
+        int n = 0;
+        for (int idx = 0; idx < p.len_; ++idx)
+            n += p.entry_[idx].is_binary();
+        return n;
+    }
+
 #   define DECLARE_MD_STUB(stub) \
     virtual const mkldnn::impl::memory_desc_t *stub(int idx = 0) const \
     { return nullptr; }
@@ -116,8 +135,12 @@ struct mkldnn_primitive_desc: public mkldnn::impl::c_compatible {
         using namespace mkldnn::impl;
         using namespace mkldnn::impl::status;
         using pd_op_desc_t = typename pkind_traits<pd_t::base_pkind>::desc_type;
-        if (adesc->kind != pd_t::base_pkind) return invalid_arguments;
-        assert(hint_fwd ? hint_fwd->kind() == pd_t::base_pkind : true);
+        /* logsoftmax shares the softmax primitive descriptors */
+        const bool kind_ok = adesc->kind == pd_t::base_pkind
+            || (pd_t::base_pkind == primitive_kind::softmax
+                    && adesc->kind == primitive_kind::logsoftmax);
+        if (!kind_ok) return invalid_arguments;
+        assert(hint_fwd ? hint_fwd->kind() == adesc->kind : true);
         auto hint =
             reinterpret_cast<const typename pd_t::hint_class *>(hint_fwd);
         auto _pd = new pd_t(engine, (const pd_op_desc_t *)adesc, attr, hint);
@@ -14,6 +14,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "c_types_map.hpp"
 #include "mkldnn_thread.hpp"
 #include "utils.hpp"
 
@@ -25,80 +30,38 @@ namespace impl {
 /* Allocating memory buffers on a page boundary to reduce TLB/page misses */
 const size_t page_size = 2097152;
 
-/*
-  Implementation of the scratchpad_t interface that is compatible with
-  a concurrent execution
-*/
-struct concurent_scratchpad_t : public scratchpad_t {
-    concurent_scratchpad_t(size_t size) {
-        size_ = size;
-        scratchpad_ = (char *) malloc(size, page_size);
-        assert(scratchpad_ != nullptr);
-    }
-
-    ~concurent_scratchpad_t() {
-        free(scratchpad_);
-    }
-
-    virtual char *get() const {
-        return scratchpad_;
-    }
-
-private:
-    char *scratchpad_;
-    size_t size_;
-};
-
-/*
-  Implementation of the scratchpad_t interface that uses a global
-  scratchpad
-*/
+void scratchpad_arena_t::grow(size_t size) {
+    static const bool use_huge_pages
+        = getenv_int("MKLDNN_SCRATCHPAD_HUGE_PAGES", 0) != 0;
+    static const bool use_first_touch
+        = getenv_int("MKLDNN_SCRATCHPAD_FIRST_TOUCH", 0) != 0;
 
-struct global_scratchpad_t : public scratchpad_t {
-    global_scratchpad_t(size_t size) {
-        if (size > size_) {
-            if (scratchpad_ != nullptr) free(scratchpad_);
-            size_ = size;
-            scratchpad_ = (char *) malloc(size, page_size);
-            assert(scratchpad_ != nullptr);
-        }
-        reference_count_++;
-    }
-
-    ~global_scratchpad_t() {
-        reference_count_--;
-        if (reference_count_ == 0) {
-            free(scratchpad_);
-            scratchpad_ = nullptr;
-            size_ = 0;
-        }
-    }
+    free(buffer_);
 
-    virtual char *get() const {
-        return scratchpad_;
+    size_ = utils::rnd_up(size, page_size);
+    buffer_ = (char *)malloc(size_, page_size);
+    if (buffer_ == nullptr) {
+        size_ = 0;
+        return;
     }
 
-private:
-    thread_local static char *scratchpad_;
-    thread_local static size_t size_;
-    thread_local static unsigned int reference_count_;
-};
-
-thread_local char *global_scratchpad_t::scratchpad_ = nullptr;
-thread_local size_t global_scratchpad_t::size_ = 0;
-thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
-
-
-/*
-   Scratchpad creation routine
-*/
-scratchpad_t *create_scratchpad(size_t size) {
-#ifndef MKLDNN_ENABLE_CONCURRENT_EXEC
-    return new global_scratchpad_t(size);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (use_huge_pages)
+        madvise(buffer_, size_, MADV_HUGEPAGE);
 #else
-    return new concurent_scratchpad_t(size);
+    MAYBE_UNUSED(use_huge_pages);
 #endif
+
+    if (use_first_touch) {
+        const size_t sys_page_size = 4096;
+        char *buffer = buffer_;
+        parallel_nd(size_ / sys_page_size, [&](size_t p) {
+            buffer[p * sys_page_size] = 0;
+        });
+    }
 }
 
 }
 }
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -17,17 +17,48 @@
 #ifndef COMMON_SCRATCHPAD_HPP
 #define COMMON_SCRATCHPAD_HPP
 
+#include "c_types_map.hpp"
 #include "utils.hpp"
 
 namespace mkldnn {
 namespace impl {
 
-struct scratchpad_t {
-    virtual ~scratchpad_t() {}
-    virtual char *get() const = 0;
-};
+/** A growable buffer that provides the scratchpad to the primitives executed
+ * on a stream.
+ *
+ * Since a stream executes one primitive at a time, a single buffer can be
+ * shared by all of them, and the memory consumption is bounded by the
+ * largest scratchpad rather than by the sum over all the primitives. The
+ * buffer only grows, and a grow invalidates the previously returned
+ * pointers, hence a pointer is valid during one primitive execution only.
+ *
+ * Environment variables:
+ * - MKLDNN_SCRATCHPAD_HUGE_PAGES=1 requests transparent huge pages for the
+ *   buffer (Linux only);
+ * - MKLDNN_SCRATCHPAD_FIRST_TOUCH=1 touches a freshly allocated buffer from
+ *   all the threads, so that its pages are placed on the NUMA nodes of the
+ *   threads that will use them. */
+struct scratchpad_arena_t: public c_compatible {
+    scratchpad_arena_t(): buffer_(nullptr), size_(0) {}
+    ~scratchpad_arena_t() { free(buffer_); }
+
+    /** returns a buffer of at least @p size bytes */
+    char *get(size_t size) {
+        if (size > size_) grow(size);
+        return buffer_;
+    }
+
+    size_t size() const { return size_; }
 
-scratchpad_t *create_scratchpad(size_t size);
+private:
+    void grow(size_t size);
+
+    char *buffer_;
+    size_t size_;
+
+    scratchpad_arena_t(const scratchpad_arena_t &) = delete;
+    scratchpad_arena_t &operator=(const scratchpad_arena_t &) = delete;
+};
 
 }
 }
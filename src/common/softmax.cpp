@@ -29,7 +29,8 @@ using namespace mkldnn::impl::alg_kind;
 using namespace mkldnn::impl::types;
 
 namespace {
-status_t softmax_desc_init(softmax_desc_t *softmax_desc, prop_kind_t prop_kind,
+status_t softmax_desc_init(softmax_desc_t *softmax_desc,
+        primitive_kind_t primitive_kind, prop_kind_t prop_kind,
         const memory_desc_t *data_desc, const memory_desc_t *diff_desc,
         int softmax_axis) {
     bool args_ok = true
@@ -39,7 +40,7 @@ status_t softmax_desc_init(softmax_desc_t *softmax_desc, prop_kind_t prop_kind,
     if (!args_ok) return invalid_arguments;
 
     auto sd = softmax_desc_t();
-    sd.primitive_kind = primitive_kind::softmax;
+    sd.primitive_kind = primitive_kind;
     sd.prop_kind = prop_kind;
 
     bool is_bwd = (sd.prop_kind == backward_data);
@@ -57,14 +58,30 @@ status_t mkldnn_softmax_forward_desc_init(softmax_desc_t *softmax_desc,
         int softmax_axis) {
     if (!one_of(prop_kind, forward_inference, forward_training))
         return invalid_arguments;
-    return softmax_desc_init(softmax_desc, prop_kind, data_desc, nullptr,
-            softmax_axis);
+    return softmax_desc_init(softmax_desc, primitive_kind::softmax, prop_kind,
+            data_desc, nullptr, softmax_axis);
 }
 
 status_t mkldnn_softmax_backward_desc_init(softmax_desc_t *softmax_desc,
         const memory_desc_t *diff_desc, const memory_desc_t *data_desc,
         int softmax_axis) {
-    return softmax_desc_init(softmax_desc, prop_kind::backward_data,
-            data_desc, diff_desc, softmax_axis);
+    return softmax_desc_init(softmax_desc, primitive_kind::softmax,
+            prop_kind::backward_data, data_desc, diff_desc, softmax_axis);
+}
+
+status_t mkldnn_logsoftmax_forward_desc_init(
+        logsoftmax_desc_t *logsoftmax_desc, prop_kind_t prop_kind,
+        const memory_desc_t *data_desc, int logsoftmax_axis) {
+    if (!one_of(prop_kind, forward_inference, forward_training))
+        return invalid_arguments;
+    return softmax_desc_init(logsoftmax_desc, primitive_kind::logsoftmax,
+            prop_kind, data_desc, nullptr, logsoftmax_axis);
+}
+
+status_t mkldnn_logsoftmax_backward_desc_init(
+        logsoftmax_desc_t *logsoftmax_desc, const memory_desc_t *diff_desc,
+        const memory_desc_t *data_desc, int logsoftmax_axis) {
+    return softmax_desc_init(logsoftmax_desc, primitive_kind::logsoftmax,
+            prop_kind::backward_data, data_desc, diff_desc, logsoftmax_axis);
 }
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
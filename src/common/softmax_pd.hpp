@@ -34,7 +34,7 @@ struct softmax_pd_t: public primitive_desc_t {
             const softmax_desc_t *adesc,
             const primitive_attr_t *attr,
             const softmax_fwd_pd_t *hint_fwd_pd)
-        : primitive_desc_t(engine, attr, base_pkind)
+        : primitive_desc_t(engine, attr, adesc->primitive_kind)
         , desc_(*adesc)
         , hint_fwd_pd_(hint_fwd_pd)
         , data_md_(desc_.data_desc)
@@ -48,6 +48,7 @@ struct softmax_pd_t: public primitive_desc_t {
     virtual status_t query(query_t what, int idx, void *result) const override {
         switch (what) {
         case query::softmax_d:
+        case query::logsoftmax_d:
             *(const softmax_desc_t**)result = desc(); break;
         default: return primitive_desc_t::query(what, idx, result);
         }
@@ -66,6 +67,10 @@ struct softmax_pd_t: public primitive_desc_t {
 
     int ndims() const { return data_desc().ndims; }
 
+    /* logsoftmax shares the descriptor and the implementations */
+    bool is_logsoftmax() const
+    { return desc_.primitive_kind == primitive_kind::logsoftmax; }
+
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
                 prop_kind::forward_inference);
@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "primitive.hpp"
 #include "stream.hpp"
 #include "utils.hpp"
 
@@ -26,13 +27,20 @@ using namespace mkldnn::impl;
 using namespace mkldnn::impl::status;
 using namespace mkldnn::impl::utils;
 
+status_t stream_t::enqueue_primitive(const primitive_t *primitive,
+        exec_ctx_t &ctx) {
+    return primitive_execute(primitive, ctx);
+}
+
 /* API */
 
 status_t mkldnn_stream_create(stream_t **stream, engine_t *engine,
         unsigned flags) {
     bool args_ok = true
         && !utils::any_null(stream, engine)
-        && flags == stream_flags::default_flags;
+        && (flags & ~stream_flags::async) == stream_flags::default_flags
+        && IMPLICATION(flags & stream_flags::async,
+                engine->kind() == engine_kind::cpu);
     if (!args_ok)
         return invalid_arguments;
 
@@ -23,6 +23,12 @@
 #include "c_types_map.hpp"
 #include "engine.hpp"
 
+namespace mkldnn {
+namespace impl {
+struct exec_ctx_t;
+}
+}
+
 struct mkldnn_stream: public mkldnn::impl::c_compatible {
     mkldnn_stream(mkldnn::impl::engine_t *engine, unsigned flags)
         : engine_(engine), flags_(flags) {}
@@ -34,6 +40,12 @@ struct mkldnn_stream: public mkldnn::impl::c_compatible {
     /** returns stream's kind */
     unsigned flags() const { return flags_; }
 
+    /** submits @p primitive for the execution with @p ctx, which the stream
+     * may take over; executes the primitive right away by default */
+    virtual mkldnn::impl::status_t enqueue_primitive(
+            const mkldnn::impl::primitive_t *primitive,
+            mkldnn::impl::exec_ctx_t &ctx);
+
     /** blocks until all submitted primitives to the stream are completed */
     virtual mkldnn::impl::status_t wait() = 0;
 
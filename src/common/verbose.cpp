@@ -26,6 +26,7 @@
 #include "cpu/cpu_isa_traits.hpp"
 
 #include "batch_normalization_pd.hpp"
+#include "binary_pd.hpp"
 #include "pooling_pd.hpp"
 #include "concat_pd.hpp"
 #include "reorder_pd.hpp"
@@ -460,6 +461,44 @@ template <typename pd_t> static void init_info_mem(pd_t *s, char *buffer) {
             aux_str, prb_str);
 }
 
+template <typename pd_t> static void init_info_binary(pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    if (1) { // src0
+        auto md = s->src_md(0);
+        DPRINT(dat_str, MKLDNN_VERBOSE_DAT_LEN, dat_written, "src0_");
+        int l = mkldnn_md2fmt_str(dat_str + dat_written,
+                MKLDNN_VERBOSE_DAT_LEN - dat_written, md);
+        if (l >= 0) dat_written += l; else clear_buf(dat_str, dat_written);
+    }
+    if (1) { // src1
+        auto md = s->src_md(1);
+        DPRINT(dat_str, MKLDNN_VERBOSE_DAT_LEN, dat_written, " src1_");
+        int l = mkldnn_md2fmt_str(dat_str + dat_written,
+                MKLDNN_VERBOSE_DAT_LEN - dat_written, md);
+        if (l >= 0) dat_written += l; else clear_buf(dat_str, dat_written);
+    }
+    if (1) { // dst
+        auto md = s->dst_md();
+        DPRINT(dat_str, MKLDNN_VERBOSE_DAT_LEN, dat_written, " dst_");
+        int l = mkldnn_md2fmt_str(dat_str + dat_written,
+                MKLDNN_VERBOSE_DAT_LEN - dat_written, md);
+        if (l >= 0) dat_written += l; else clear_buf(dat_str, dat_written);
+    }
+
+    DPRINT(aux_str, MKLDNN_VERBOSE_AUX_LEN, aux_written,
+            "alg:%s", mkldnn_alg_kind2str(s->alg_kind()));
+
+    int l = mkldnn_md2dim_str(prb_str, MKLDNN_VERBOSE_PRB_LEN, s->src_md(0));
+    if (l >= 0) prb_written += l; else clear_buf(prb_str, prb_written);
+    DPRINT(prb_str, MKLDNN_VERBOSE_PRB_LEN, prb_written, ":");
+    mkldnn_md2dim_str(prb_str + prb_written,
+            MKLDNN_VERBOSE_PRB_LEN - prb_written, s->src_md(1));
+
+    verbose_templ(buffer, s->kind(), s->name(), prop_kind::undef, dat_str,
+            aux_str, prb_str);
+}
+
 template <typename pd_t> static void init_info_pool(pd_t *s, char *buffer) {
     DECL_DAT_AUX_PRB_STRS();
 
@@ -621,6 +660,7 @@ template <typename pd_t> static void init_info_rnn(pd_t *s, char *buffer) {
     static void CONCAT2(init_info_, name)(pd_t *s, char *buffer) \
     { UNUSED(s); UNUSED(buffer); }
 
+DEFINE_STUB(binary);
 DEFINE_STUB(bnorm);
 DEFINE_STUB(conv);
 DEFINE_STUB(eltwise);
@@ -639,6 +679,8 @@ DEFINE_STUB(shuffle);
 
 void init_info(batch_normalization_pd_t *s, char *b)
 { init_info_bnorm(s, b); }
+void init_info(binary_pd_t *s, char *b)
+{ init_info_binary(s, b); }
 void init_info(concat_pd_t *s, char *b)
 { init_info_mem(s, b); }
 void init_info(convolution_pd_t *s, char *b)
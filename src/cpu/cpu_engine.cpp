@@ -32,6 +32,7 @@
 #include "cpu/jit_avx512_common_convolution_winograd.hpp"
 #include "cpu/jit_avx512_core_x8s8s32x_convolution.hpp"
 #include "cpu/jit_avx512_common_convolution.hpp"
+#include "cpu/jit_avx512_core_bf16_convolution.hpp"
 #include "cpu/jit_avx2_1x1_convolution.hpp"
 #include "cpu/jit_sse41_1x1_convolution.hpp"
 #include "cpu/jit_avx2_convolution.hpp"
@@ -43,8 +44,11 @@
 #include "cpu/jit_avx512_core_x8s8s32x_1x1_deconvolution.hpp"
 #include "cpu/ref_deconvolution.hpp"
 #include "cpu/ref_shuffle.hpp"
+#include "cpu/jit_uni_binary.hpp"
+#include "cpu/ref_binary.hpp"
 #include "cpu/jit_uni_eltwise.hpp"
 #include "cpu/ref_eltwise.hpp"
+#include "cpu/jit_uni_softmax.hpp"
 #include "cpu/ref_softmax.hpp"
 #include "cpu/jit_uni_pooling.hpp"
 #include "cpu/jit_uni_i8i8_pooling.hpp"
@@ -60,6 +64,7 @@
 #include "cpu/nspc_batch_normalization.hpp"
 #include "cpu/ref_inner_product.hpp"
 #include "cpu/gemm_inner_product.hpp"
+#include "cpu/gemm_bf16_inner_product.hpp"
 #include "cpu/gemm_x8s8s32x_inner_product.hpp"
 #include "cpu/jit_uni_dw_convolution.hpp"
 #include "cpu/jit_avx512_core_u8s8s32x_wino_convolution.hpp"
@@ -128,6 +133,10 @@ static const pd_create_f cpu_impl_list[] = {
     INSTANCE(ref_convolution_fwd_t<f32>),
     INSTANCE(ref_convolution_bwd_data_t<f32, f32, f32, f32>),
     INSTANCE(ref_convolution_bwd_weights_t<f32, f32, f32, f32>),
+    /* conv (bf16) */
+    INSTANCE(jit_avx512_core_bf16_convolution_fwd_t),
+    INSTANCE(jit_avx512_core_bf16_convolution_bwd_data_t),
+    INSTANCE(jit_avx512_core_bf16_convolution_bwd_weights_t),
     /* conv (int) */
     INSTANCE(jit_avx512_core_u8s8s32x_wino_convolution_fwd_t<f32>),
     INSTANCE(jit_avx512_core_u8s8s32x_wino_convolution_fwd_t<s32>),
@@ -193,6 +202,15 @@ static const pd_create_f cpu_impl_list[] = {
     INSTANCE(ref_shuffle_t<4>), /* f32 or s32 */
     INSTANCE(ref_shuffle_t<2>), /* bf16 */
     INSTANCE(ref_shuffle_t<1>), /* s8 or u8 */
+    /* binary */
+    INSTANCE(jit_uni_binary_t<avx512_common>),
+    INSTANCE(jit_uni_binary_t<avx2>),
+    INSTANCE(ref_binary_t<f32>),
+    INSTANCE(ref_binary_t<bf16>),
+    INSTANCE(ref_binary_t<s8>),
+    INSTANCE(ref_binary_t<u8>),
+    INSTANCE(ref_binary_t<s8, u8, s8>),
+    INSTANCE(ref_binary_t<u8, s8, u8>),
     /* eltwise */
     INSTANCE(jit_uni_eltwise_fwd_t<avx512_common, f32>),
     INSTANCE(jit_uni_eltwise_bwd_t<avx512_common, f32>),
@@ -212,7 +230,13 @@ static const pd_create_f cpu_impl_list[] = {
     INSTANCE(ref_eltwise_fwd_t<u8>),
     INSTANCE(ref_eltwise_bwd_t<s32>),
     /* softmax */
+    INSTANCE(jit_uni_softmax_fwd_t<avx512_common>),
+    INSTANCE(jit_uni_softmax_fwd_t<avx2>),
+    INSTANCE(jit_uni_softmax_fwd_t<sse41>),
     INSTANCE(ref_softmax_fwd_t<f32>),
+    INSTANCE(jit_uni_softmax_bwd_t<avx512_common>),
+    INSTANCE(jit_uni_softmax_bwd_t<avx2>),
+    INSTANCE(jit_uni_softmax_bwd_t<sse41>),
     INSTANCE(ref_softmax_bwd_t<f32>),
     /* pool */
     INSTANCE(jit_uni_pooling_fwd_t<avx512_common>),
@@ -266,6 +290,13 @@ static const pd_create_f cpu_impl_list[] = {
     INSTANCE(ref_inner_product_fwd_t<f32>),
     INSTANCE(ref_inner_product_bwd_data_t<f32, f32, f32, f32>),
     INSTANCE(ref_inner_product_bwd_weights_t<f32>),
+    /* inner product (bf16) */
+    INSTANCE(gemm_bf16_inner_product_fwd_t<f32>),
+    INSTANCE(gemm_bf16_inner_product_fwd_t<bf16>),
+    INSTANCE(gemm_bf16_inner_product_bwd_data_t<f32>),
+    INSTANCE(gemm_bf16_inner_product_bwd_data_t<bf16>),
+    INSTANCE(gemm_bf16_inner_product_bwd_weights_t<f32>),
+    INSTANCE(gemm_bf16_inner_product_bwd_weights_t<bf16>),
     /* inner product (int) */
     INSTANCE(gemm_x8s8s32x_inner_product_fwd_t<u8, u8>),
     INSTANCE(gemm_x8s8s32x_inner_product_fwd_t<u8, s8>),
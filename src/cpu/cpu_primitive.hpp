@@ -17,14 +17,19 @@
 #ifndef CPU_PRIMITIVE_HPP
 #define CPU_PRIMITIVE_HPP
 
+#include <assert.h>
+
 #include "mkldnn.h"
 
 #include "c_types_map.hpp"
 #include "memory_tracking.hpp"
+#include "nstl.hpp"
 #include "primitive.hpp"
 #include "primitive_exec_types.hpp"
 #include "scratchpad.hpp"
 
+#include "cpu_stream.hpp"
+
 #include <type_traits>
 
 #define ARG_TYPE(t) \
@@ -41,44 +46,64 @@ namespace impl {
 namespace cpu {
 
 struct cpu_primitive_t: public primitive_t {
-    cpu_primitive_t(const primitive_desc_t *pd,
-            bool use_global_scratchpad = false)
-        : primitive_t(pd)
-        , scratchpad_buffer_(nullptr)
-        , global_scratchpad_(nullptr)
-    {
-        const size_t scratchpad_size =
-            this->pd()->scratchpad_size(scratchpad_mode::library);
-
-        if (scratchpad_size) {
-            if (use_global_scratchpad)
-                global_scratchpad_ = create_scratchpad(scratchpad_size);
-            else
-                scratchpad_buffer_ = malloc(scratchpad_size, 64);
-        }
-    }
-
-    virtual ~cpu_primitive_t() {
-        delete global_scratchpad_;
-        free(scratchpad_buffer_);
+    cpu_primitive_t(const primitive_desc_t *pd): primitive_t(pd) {}
+
+    virtual ~cpu_primitive_t() {}
+
+    /* In the library scratchpad mode the buffer is taken from the stream
+     * arena before the execution, so that an allocation failure is reported
+     * as a status rather than handed to the kernels as a null pointer */
+    virtual status_t prepare_exec(const exec_ctx_t &ctx) const override {
+        if (pd()->attr()->scratchpad_mode_ == scratchpad_mode::user)
+            return status::success;
+        const size_t size = pd()->scratchpad_size(scratchpad_mode::library);
+        if (size == 0) return status::success;
+
+        auto *stream = utils::downcast<cpu_stream_t *>(ctx.stream());
+        return stream->scratchpad_arena().get(size) != nullptr
+            ? status::success : status::out_of_memory;
     }
 
 protected:
+    /* In the library scratchpad mode the memory comes from the stream the
+     * primitive is executed on, and is valid during the execution only.
+     * Hence a primitive that executes other primitives on the same stream
+     * must not use a scratchpad on its own. */
     memory_tracking::grantor_t scratchpad(const exec_ctx_t &ctx) const {
         void *ptr = nullptr;
         if (pd()->attr()->scratchpad_mode_ == scratchpad_mode::user) {
             ptr = CTX_OUT_MEM(void *, MKLDNN_ARG_SCRATCHPAD);
         } else {
-            ptr = global_scratchpad_
-                ? global_scratchpad_->get() : scratchpad_buffer_;
+            const size_t size = pd()->scratchpad_size(scratchpad_mode::library);
+            if (size) {
+                auto *stream = utils::downcast<cpu_stream_t *>(ctx.stream());
+                ptr = stream->scratchpad_arena().get(size);
+                /* prepare_exec() has grown the arena already */
+                assert(ptr != nullptr);
+            }
         }
 
         return pd()->scratchpad_registry().grantor(ptr);
     }
 
-private:
-    void *scratchpad_buffer_;
-    scratchpad_t *global_scratchpad_;
+    /* src1 of the binary post-ops indexed by the post-op position, nullptr
+     * for the other kinds of post-ops. Returns nullptr if there are no binary
+     * post-ops, otherwise rhs, which must fit all the post-ops. */
+    template <int N>
+    const void *const *binary_po_rhs(const exec_ctx_t &ctx,
+            const void *(&rhs)[N]) const {
+        const auto &po = pd()->attr()->post_ops_;
+        if (po.find(primitive_kind::binary) == -1) return nullptr;
+
+        assert(po.len_ <= N);
+        for (int idx = 0; idx < po.len_; ++idx)
+            rhs[idx] = po.entry_[idx].is_binary()
+                ? CTX_IN_MEM(const void *,
+                        MKLDNN_ARG_ATTR_MULTIPLE_POST_OP(idx)
+                        | MKLDNN_ARG_SRC_1)
+                : nullptr;
+        return rhs;
+    }
 };
 
 }
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/primitive.hpp"
+
+#include "cpu_stream.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+cpu_stream_t::~cpu_stream_t() {
+    if (!worker_.joinable()) return;
+
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    submitted_.notify_one();
+    worker_.join();
+}
+
+status_t cpu_stream_t::enqueue_primitive(
+        const primitive_t *primitive, exec_ctx_t &ctx) {
+    if (!is_async()) return primitive_execute(primitive, ctx);
+
+    /* the user may destroy the primitive right after the submission */
+    const_cast<primitive_t *>(primitive)->retain();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!worker_.joinable())
+        worker_ = std::thread(&cpu_stream_t::worker_loop, this);
+    queue_.push_back({primitive, std::move(ctx)});
+    submitted_.notify_one();
+
+    return status::success;
+}
+
+status_t cpu_stream_t::wait() {
+    if (!is_async()) return status::success;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    drained_.wait(lock, [&]() { return queue_.empty() && !busy_; });
+
+    status_t status = status_;
+    status_ = status::success;
+    return status;
+}
+
+void cpu_stream_t::worker_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        submitted_.wait(lock, [&]() { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) break; // stop_ is only set on a drained queue
+
+        task_t task = std::move(queue_.front());
+        queue_.pop_front();
+        busy_ = true;
+        lock.unlock();
+
+        status_t status = primitive_execute(task.primitive, task.ctx);
+        const_cast<primitive_t *>(task.primitive)->release();
+
+        lock.lock();
+        busy_ = false;
+        if (status_ == status::success) status_ = status;
+        if (queue_.empty()) drained_.notify_all();
+    }
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace mkldnn
@@ -17,7 +17,14 @@
 #ifndef CPU_STREAM_HPP
 #define CPU_STREAM_HPP
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "common/c_types_map.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/scratchpad.hpp"
 #include "common/stream.hpp"
 
 namespace mkldnn {
@@ -26,12 +33,40 @@ namespace cpu {
 
 struct cpu_stream_t : public stream_t {
     cpu_stream_t(engine_t *engine, unsigned flags) : stream_t(engine, flags) {}
-    virtual ~cpu_stream_t() = default;
+    virtual ~cpu_stream_t();
+
+    /** a synchronous stream executes @p primitive right away, an asynchronous
+     * one (stream_flags::async) appends it to the queue of its worker */
+    virtual status_t enqueue_primitive(
+            const primitive_t *primitive, exec_ctx_t &ctx) override;
+
+    /** waits for the worker to drain the queue, and returns the status of
+     * the first primitive that failed since the previous wait() */
+    virtual status_t wait() override;
+
+    /** the scratchpad shared by the primitives executed on the stream */
+    scratchpad_arena_t &scratchpad_arena() { return scratchpad_arena_; }
+
+private:
+    bool is_async() const { return flags() & stream_flags::async; }
+    void worker_loop();
+
+    scratchpad_arena_t scratchpad_arena_;
+
+    /* asynchronous execution: the primitives are executed in submission
+     * order, so a primitive always sees the results of the preceding ones */
+    struct task_t {
+        const primitive_t *primitive;
+        exec_ctx_t ctx;
+    };
 
-    virtual mkldnn::impl::status_t wait() override {
-        // CPU execution is synchronous so return immediately
-        return mkldnn::impl::status::success;
-    }
+    std::mutex mutex_;
+    std::condition_variable submitted_, drained_;
+    std::deque<task_t> queue_;
+    std::thread worker_;
+    bool busy_ = false;
+    bool stop_ = false;
+    status_t status_ = status::success;
 };
 
 } // namespace cpu
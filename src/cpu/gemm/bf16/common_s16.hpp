@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_S16_HPP
+#define COMMON_S16_HPP
+
+#include "jit_generator.hpp"
+
+#define S16_COPY_KERNEL_CODE_SIZE          (4096L * 2)
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+/* Packing of bf16 matrices for jit_avx512_core_gemm_bf16bf16f32_kern.
+ *
+ * A panel of w rows of A (or w columns of B) over k is stored as ceil(k/2)
+ * pairs; a pair holds one dword per row (column), with the even k in the
+ * low and the odd k in the high word, so the compute kernel can feed it to
+ * vdpbf16ps directly. An odd k is padded with a zero word. Panels of A are
+ * padded with zero rows to a multiple of 16. */
+struct jit_gemm_bf16_copy_call_s {
+    const void *src;
+    void *dst;
+    dim_t ld; // in elements
+    dim_t k;
+    dim_t w;
+};
+
+class jit_avx512_core_s16_copy_kern : public jit_generator {
+public:
+    static const int unroll_a = 48;
+    static const int unroll_b = 8;
+
+    jit_avx512_core_s16_copy_kern(bool is_a, bool is_trans);
+
+    void operator()(jit_gemm_bf16_copy_call_s *p) const { ker_(p); }
+
+protected:
+    /* For a non-transposed A and a transposed B the panel is contiguous
+     * along w, otherwise it is contiguous along k. */
+    bool is_a_, interleave_;
+    int max_chunks_;
+
+    void generate();
+    void interleave_loop(int nchunks);
+    void gather_loop(int nchunks);
+
+private:
+    void (*ker_)(jit_gemm_bf16_copy_call_s *);
+
+    Xbyak::Reg64 param_ = abi_param1;
+    Xbyak::Reg64 reg_src_ = r8;
+    Xbyak::Reg64 reg_dst_ = r9;
+    Xbyak::Reg64 reg_ld_ = r10;
+    Xbyak::Reg64 reg_k_ = r11;
+    Xbyak::Reg64 reg_w_ = r12;
+    Xbyak::Reg64 reg_dst_stride_ = r13;
+    Xbyak::Reg64 reg_loop_ = r14;
+    Xbyak::Reg64 reg_aux_ = r15;
+    Xbyak::Reg64 reg_tmp_ = rax;
+
+    Xbyak::Label l_iota_;
+};
+
+class jit_avx512_core_s16_copy_an_kern : public jit_avx512_core_s16_copy_kern {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_s16_copy_an_kern);
+
+    public:
+        jit_avx512_core_s16_copy_an_kern()
+            : jit_avx512_core_s16_copy_kern(true, false) { generate(); }
+};
+
+class jit_avx512_core_s16_copy_at_kern : public jit_avx512_core_s16_copy_kern {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_s16_copy_at_kern);
+
+    public:
+        jit_avx512_core_s16_copy_at_kern()
+            : jit_avx512_core_s16_copy_kern(true, true) { generate(); }
+};
+
+class jit_avx512_core_s16_copy_bn_kern : public jit_avx512_core_s16_copy_kern {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_s16_copy_bn_kern);
+
+    public:
+        jit_avx512_core_s16_copy_bn_kern()
+            : jit_avx512_core_s16_copy_kern(false, false) { generate(); }
+};
+
+class jit_avx512_core_s16_copy_bt_kern : public jit_avx512_core_s16_copy_kern {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_s16_copy_bt_kern);
+
+    public:
+        jit_avx512_core_s16_copy_bt_kern()
+            : jit_avx512_core_s16_copy_kern(false, true) { generate(); }
+};
+
+}
+}
+}
+
+#endif // COMMON_S16_HPP
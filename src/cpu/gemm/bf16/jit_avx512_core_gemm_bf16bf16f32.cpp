@@ -0,0 +1,240 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <mutex>
+
+#include "mkldnn_thread.hpp"
+#include "mkldnn_types.h"
+#include "nstl.hpp"
+#include "utils.hpp"
+
+#include "jit_generator.hpp"
+
+#include "common_s16.hpp"
+#include "jit_avx512_core_gemm_bf16bf16f32.hpp"
+#include "jit_avx512_core_gemm_bf16bf16f32_kern.hpp"
+#include "ref_gemm_bf16bf16f32.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace utils;
+
+namespace {
+
+struct gemm_bf16_kernels_t {
+    // [is_trans]
+    jit_avx512_core_s16_copy_kern *copy_a[2];
+    jit_avx512_core_s16_copy_kern *copy_b[2];
+    // [beta_zero]
+    jit_avx512_core_gemm_bf16bf16f32_kern *kern[2];
+};
+
+const gemm_bf16_kernels_t &get_gemm_bf16_kernels() {
+    static gemm_bf16_kernels_t kernels;
+    static std::once_flag initialized;
+    std::call_once(initialized, [&]{
+        kernels.copy_a[0] = new jit_avx512_core_s16_copy_an_kern();
+        kernels.copy_a[1] = new jit_avx512_core_s16_copy_at_kern();
+        kernels.copy_b[0] = new jit_avx512_core_s16_copy_bn_kern();
+        kernels.copy_b[1] = new jit_avx512_core_s16_copy_bt_kern();
+        for (bool beta_zero: {false, true})
+            kernels.kern[beta_zero]
+                = new jit_avx512_core_gemm_bf16bf16f32_kern(beta_zero);
+    });
+    return kernels;
+}
+
+const int um = jit_avx512_core_gemm_bf16bf16f32_kern::unroll_m;
+const int un = jit_avx512_core_gemm_bf16bf16f32_kern::unroll_n;
+
+// Blocking; BK is kept even so that only the last k block has an odd tail.
+const int BM = 8 * um;
+const int BN = 384;
+const int BK = 768;
+
+// Picks a 2D partition of C minimizing the largest tile per thread.
+void calc_nthr(int m, int n, int nthr, int &nthr_m, int &nthr_n) {
+    const dim_t m_panels = div_up(m, um), n_panels = div_up(n, un);
+    dim_t best_area = -1, best_perimeter = -1;
+    nthr_m = nthr_n = 1;
+    for (int d = 1; d <= nthr; d++) {
+        if (nthr % d != 0) continue;
+        const int tm = d, tn = nthr / d;
+        const dim_t mb = div_up(m_panels, tm) * um;
+        const dim_t nb = div_up(n_panels, tn) * un;
+        const dim_t area = mb * nb, perimeter = mb + nb;
+        if (best_area < 0 || area < best_area
+                || (area == best_area && perimeter < best_perimeter)) {
+            best_area = area;
+            best_perimeter = perimeter;
+            nthr_m = tm;
+            nthr_n = tn;
+        }
+    }
+}
+
+void scale_c(int m, int n, float beta, float *c, dim_t ldc) {
+    for (int j = 0; j < n; j++) {
+        float *c_j = c + j * ldc;
+        if (beta == 0.0f) {
+            PRAGMA_OMP_SIMD()
+            for (int i = 0; i < m; i++)
+                c_j[i] = 0.0f;
+        } else {
+            PRAGMA_OMP_SIMD()
+            for (int i = 0; i < m; i++)
+                c_j[i] *= beta;
+        }
+    }
+}
+
+}
+
+mkldnn_status_t jit_avx512_core_gemm_bf16bf16f32(
+        const char *transa, const char *transb, const int *p_m,
+        const int *p_n, const int *p_k, const float *p_alpha,
+        const bfloat16_t *A, const int *p_lda, const bfloat16_t *B,
+        const int *p_ldb, const float *p_beta, float *C, const int *p_ldc) {
+    const bool is_trans_a = *transa == 'T' || *transa == 't';
+    const bool is_trans_b = *transb == 'T' || *transb == 't';
+
+    const int m = *p_m, n = *p_n, k = *p_k;
+    const dim_t lda = *p_lda, ldb = *p_ldb, ldc = *p_ldc;
+    const float alpha = *p_alpha, beta = *p_beta;
+
+    if (m <= 0 || n <= 0)
+        return mkldnn_success;
+
+    // The copy kernels gather along the leading dimension with 32-bit
+    // offsets.
+    const dim_t max_gather_ld = INT32_MAX / (2 * um);
+    if ((is_trans_a && lda > max_gather_ld)
+            || (!is_trans_b && ldb > max_gather_ld))
+        return ref_gemm_bf16bf16f32(transa, transb, p_m, p_n, p_k, p_alpha,
+                A, p_lda, B, p_ldb, p_beta, C, p_ldc);
+
+    if (k <= 0 || alpha == 0.0f) {
+        if (beta != 1.0f)
+            parallel_nd(n, [&](int j) {
+                scale_c(m, 1, beta, C + j * ldc, ldc);
+            });
+        return mkldnn_success;
+    }
+
+    const auto &kernels = get_gemm_bf16_kernels();
+    const auto *copy_a = kernels.copy_a[is_trans_a];
+    const auto *copy_b = kernels.copy_b[is_trans_b];
+
+    int nthr = mkldnn_in_parallel() ? 1 : mkldnn_get_max_threads();
+    int nthr_m, nthr_n;
+    calc_nthr(m, n, nthr, nthr_m, nthr_n);
+    nthr = nthr_m * nthr_n;
+
+    const size_t a_buf_size = (size_t)BM * BK * sizeof(bfloat16_t);
+    const size_t b_buf_size = (size_t)BN * BK * sizeof(bfloat16_t);
+    const size_t buf_size_per_thr = rnd_up(a_buf_size + b_buf_size, PAGE_4K);
+    char *buffers = (char *)malloc(nthr * buf_size_per_thr, PAGE_4K);
+    if (buffers == nullptr)
+        return mkldnn_out_of_memory;
+
+    parallel(nthr, [&](const int ithr, const int) {
+        const int ithr_m = ithr % nthr_m, ithr_n = ithr / nthr_m;
+
+        int mp_start {0}, mp_end {0}, np_start {0}, np_end {0};
+        balance211((int)div_up(m, um), nthr_m, ithr_m, mp_start, mp_end);
+        balance211((int)div_up(n, un), nthr_n, ithr_n, np_start, np_end);
+
+        const int m_start = mp_start * um;
+        const int m_end = nstl::min(mp_end * um, m);
+        const int n_start = np_start * un;
+        const int n_end = nstl::min(np_end * un, n);
+        if (m_start >= m_end || n_start >= n_end)
+            return;
+
+        char *buf = buffers + ithr * buf_size_per_thr;
+        bfloat16_t *a_buf = (bfloat16_t *)buf;
+        bfloat16_t *b_buf = (bfloat16_t *)(buf + a_buf_size);
+
+        if (beta != 0.0f && beta != 1.0f)
+            scale_c(m_end - m_start, n_end - n_start, beta,
+                    C + m_start + n_start * ldc, ldc);
+
+        for (int k0 = 0; k0 < k; k0 += BK) {
+            const int kb = nstl::min(BK, k - k0);
+            const dim_t k_pairs = div_up(kb, 2);
+            const auto *kern = kernels.kern[k0 == 0 && beta == 0.0f];
+
+            for (int n0 = n_start; n0 < n_end; n0 += BN) {
+                const int nb = nstl::min(BN, n_end - n0);
+
+                bfloat16_t *b_panel = b_buf;
+                for (int j = n0; j < n0 + nb; j += un) {
+                    jit_gemm_bf16_copy_call_s p;
+                    p.src = is_trans_b
+                        ? &B[j + k0 * ldb] : &B[k0 + j * ldb];
+                    p.dst = b_panel;
+                    p.ld = ldb;
+                    p.k = kb;
+                    p.w = nstl::min(un, n0 + nb - j);
+                    (*copy_b)(&p);
+                    b_panel += p.w * k_pairs * 2;
+                }
+
+                for (int m0 = m_start; m0 < m_end; m0 += BM) {
+                    const int mb = nstl::min(BM, m_end - m0);
+
+                    bfloat16_t *a_panel = a_buf;
+                    for (int i = m0; i < m0 + mb; i += um) {
+                        jit_gemm_bf16_copy_call_s p;
+                        p.src = is_trans_a
+                            ? &A[k0 + i * lda] : &A[i + k0 * lda];
+                        p.dst = a_panel;
+                        p.ld = lda;
+                        p.k = kb;
+                        p.w = nstl::min(um, m0 + mb - i);
+                        (*copy_a)(&p);
+                        a_panel += rnd_up(p.w, 16) * k_pairs * 2;
+                    }
+
+                    a_panel = a_buf;
+                    for (int i = m0; i < m0 + mb; i += um) {
+                        jit_gemm_bf16_kern_call_s p;
+                        p.a = a_panel;
+                        p.b = b_buf;
+                        p.c = &C[i + n0 * ldc];
+                        p.ldc = ldc;
+                        p.k_pairs = k_pairs;
+                        p.m = nstl::min(um, m0 + mb - i);
+                        p.n = nb;
+                        p.alpha = &alpha;
+                        (*kern)(&p);
+                        a_panel += rnd_up(p.m, 16) * k_pairs * 2;
+                    }
+                }
+            }
+        }
+    });
+
+    free(buffers);
+
+    return mkldnn_success;
+}
+
+}
+}
+}
@@ -0,0 +1,183 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "jit_avx512_core_gemm_bf16bf16f32_kern.hpp"
+
+#include "cpu_isa_traits.hpp"
+#include "jit_generator.hpp"
+
+#define GET_OFF(field) offsetof(jit_gemm_bf16_kern_call_s, field)
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+
+void jit_avx512_core_gemm_bf16bf16f32_kern::dot_product(const Zmm &dst,
+        const Zmm &src1, const Zmm &src2) {
+    if (bf16_emu_)
+        bf16_emu_->vdpbf16ps(dst, src1, src2);
+    else
+        vdpbf16ps(dst, src1, src2);
+}
+
+// One m_vecs * 16 by unroll_n block of C over all of k.
+void jit_avx512_core_gemm_bf16bf16f32_kern::innerloop(int m_vecs,
+        int unroll_n) {
+    Label label_k_loop;
+
+    for (int i = 0; i < m_vecs; i++)
+        for (int j = 0; j < unroll_n; j++)
+            vpxord(c_reg(i, j), c_reg(i, j), c_reg(i, j));
+
+    mov(AO_, A_);
+    mov(LoopCount_, K_);
+
+    L_aligned(label_k_loop); {
+        for (int i = 0; i < m_vecs; i++)
+            vmovups(a_reg(i), ptr[AO_ + 64 * i]);
+
+        for (int j = 0; j < unroll_n; j++) {
+            vpbroadcastd(b_reg_, ptr[B_ + 4 * j]);
+            for (int i = 0; i < m_vecs; i++)
+                dot_product(c_reg(i, j), a_reg(i), b_reg_);
+        }
+
+        prefetcht0(ptr[AO_ + 64 * m_vecs * 8]);
+
+        add(AO_, 64 * m_vecs);
+        add(B_, 4 * unroll_n);
+        dec(LoopCount_);
+        jnz(label_k_loop, T_NEAR);
+    }
+
+    // C updates; k1..k3 mask the rows of the panel.
+    mov(CO_, C_);
+    for (int j = 0; j < unroll_n; j++) {
+        for (int i = 0; i < m_vecs; i++) {
+            Zmm c = c_reg(i, j);
+            Opmask mask(i + 1);
+            auto c_mem = ptr[CO_ + 64 * i];
+
+            vmulps(c, c, alpha_);
+            if (!beta_zero_) {
+                vmovups(c_tmp_ | mask | T_z, c_mem);
+                vaddps(c, c, c_tmp_);
+            }
+            vmovups(c_mem | mask, c);
+        }
+        add(CO_, LDC_);
+    }
+
+    imul(tmp_, LDC_, unroll_n);
+    add(C_, tmp_);
+    sub(N_, unroll_n);
+}
+
+// Loop over the panels of B; the last one may be narrower than unroll_n.
+void jit_avx512_core_gemm_bf16bf16f32_kern::outerloop(int m_vecs) {
+    Label label_n_loop, label_n_remainder, label_end;
+    Label label_n_tails[unroll_n];
+
+    cmp(N_, unroll_n);
+    jl(label_n_remainder, T_NEAR);
+
+    L_aligned(label_n_loop); {
+        innerloop(m_vecs, unroll_n);
+        cmp(N_, unroll_n);
+        jge(label_n_loop, T_NEAR);
+    }
+
+    L(label_n_remainder);
+    for (int un = 1; un < unroll_n; un++) {
+        cmp(N_, un);
+        je(label_n_tails[un], T_NEAR);
+    }
+    jmp(label_end, T_NEAR);
+
+    for (int un = 1; un < unroll_n; un++) {
+        L(label_n_tails[un]);
+        innerloop(m_vecs, un);
+        jmp(label_end, T_NEAR);
+    }
+
+    L(label_end);
+}
+
+void jit_avx512_core_gemm_bf16bf16f32_kern::generate() {
+    preamble();
+
+    mov(A_, ptr[param_ + GET_OFF(a)]);
+    mov(B_, ptr[param_ + GET_OFF(b)]);
+    mov(C_, ptr[param_ + GET_OFF(c)]);
+    mov(LDC_, ptr[param_ + GET_OFF(ldc)]);
+    mov(K_, ptr[param_ + GET_OFF(k_pairs)]);
+    mov(N_, ptr[param_ + GET_OFF(n)]);
+    mov(tmp_, ptr[param_ + GET_OFF(alpha)]);
+    vbroadcastss(alpha_, ptr[tmp_]);
+
+    lea(LDC_, ptr[LDC_ * sizeof(float)]);
+
+    // Row masks for the three vectors of a panel.
+    reg64_t m = AO_, cnt = LoopCount_;
+    mov(m, ptr[param_ + GET_OFF(m)]);
+    for (int i = 0; i < unroll_m / 16; i++) {
+        xor_(tmp_, tmp_);
+        mov(cnt, m);
+        sub(cnt, 16 * i);
+        cmovs(cnt, tmp_);
+        mov(tmp_, 16);
+        cmp(cnt, tmp_);
+        cmovg(cnt, tmp_);
+        mov(tmp_, -1);
+        bzhi(tmp_, tmp_, cnt);
+        kmovw(Opmask(i + 1), tmp_.cvt32());
+    }
+
+    Label label_m_vecs[unroll_m / 16], label_end;
+    for (int mv = unroll_m / 16; mv > 0; mv--) {
+        L(label_m_vecs[mv - 1]);
+        if (mv > 1) {
+            cmp(m, 16 * (mv - 1));
+            jle(label_m_vecs[mv - 2], T_NEAR);
+        }
+        outerloop(mv);
+        jmp(label_end, T_NEAR);
+    }
+    L(label_end);
+
+    postamble();
+
+    ker_ = getCode<decltype(ker_)>();
+}
+
+jit_avx512_core_gemm_bf16bf16f32_kern::jit_avx512_core_gemm_bf16bf16f32_kern(
+        bool beta_zero)
+    : jit_generator(nullptr, 256 * 1024)
+    , beta_zero_(beta_zero)
+    , ker_(nullptr)
+    , bf16_emu_(nullptr) {
+    if (!mayiuse(avx512_core_bf16))
+        bf16_emu_ = new bf16_emulation_t(this, c_tmp_, c_tmp_, c_tmp_, tmp_,
+                bf16_emu_reserv_1, bf16_emu_reserv_2);
+
+    generate();
+}
+
+}
+}
+}
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_AVX512_CORE_GEMM_BF16BF16F32_KERN_HPP
+#define JIT_AVX512_CORE_GEMM_BF16BF16F32_KERN_HPP
+
+#include "jit_avx512_core_bf16cvt.hpp"
+#include "jit_generator.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+struct jit_gemm_bf16_kern_call_s {
+    const void *a; // one packed panel of A
+    const void *b; // packed B
+    float *c;
+    dim_t ldc;
+    dim_t k_pairs;
+    dim_t m; // rows of the panel, at most 48
+    dim_t n;
+    const float *alpha;
+};
+
+/* Computes C = alpha * A * B (+ C unless beta_zero) for one packed panel of
+ * A against all the packed panels of B, accumulating in f32 with vdpbf16ps,
+ * or its emulation on avx512_core. */
+class jit_avx512_core_gemm_bf16bf16f32_kern : public jit_generator {
+public:
+    jit_avx512_core_gemm_bf16bf16f32_kern(bool beta_zero);
+    ~jit_avx512_core_gemm_bf16bf16f32_kern() { delete bf16_emu_; }
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_gemm_bf16bf16f32_kern);
+
+    void operator()(jit_gemm_bf16_kern_call_s *p) const { ker_(p); }
+
+    static const int unroll_m = 48;
+    static const int unroll_n = 8;
+
+protected:
+    bool beta_zero_;
+
+    void dot_product(const Xbyak::Zmm &dst, const Xbyak::Zmm &src1,
+            const Xbyak::Zmm &src2);
+    void innerloop(int m_vecs, int unroll_n);
+    void outerloop(int m_vecs);
+    void generate();
+
+private:
+    void (*ker_)(jit_gemm_bf16_kern_call_s *);
+
+    using reg64_t = const Xbyak::Reg64;
+
+    reg64_t param_ = abi_param1;
+    reg64_t A_ = r8;
+    reg64_t B_ = r9;
+    reg64_t C_ = r10;
+    reg64_t LDC_ = r11;
+    reg64_t K_ = r12;
+    reg64_t N_ = r13;
+    reg64_t AO_ = r14;
+    reg64_t LoopCount_ = r15;
+    reg64_t CO_ = rbx;
+    reg64_t tmp_ = rax;
+
+    Xbyak::Zmm b_reg_ = Xbyak::Zmm(3);
+    Xbyak::Zmm alpha_ = Xbyak::Zmm(4);
+    Xbyak::Zmm c_tmp_ = Xbyak::Zmm(5);
+    Xbyak::Zmm a_reg(int i) { return Xbyak::Zmm(i); }
+    Xbyak::Zmm c_reg(int i, int j) { return Xbyak::Zmm(8 + i * 8 + j); }
+
+    /* vdpbf16ps emulation needs two temporaries */
+    Xbyak::Zmm bf16_emu_reserv_1 = Xbyak::Zmm(6);
+    Xbyak::Zmm bf16_emu_reserv_2 = Xbyak::Zmm(7);
+    bf16_emulation_t *bf16_emu_;
+};
+
+}
+}
+}
+
+#endif // JIT_AVX512_CORE_GEMM_BF16BF16F32_KERN_HPP
@@ -0,0 +1,210 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common_s16.hpp"
+#include "jit_generator.hpp"
+
+#define GET_OFF(field) offsetof(jit_gemm_bf16_copy_call_s, field)
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+
+jit_avx512_core_s16_copy_kern::jit_avx512_core_s16_copy_kern(bool is_a,
+        bool is_trans)
+    : jit_generator(nullptr, S16_COPY_KERNEL_CODE_SIZE)
+    , is_a_(is_a)
+    , interleave_(is_a != is_trans)
+    , max_chunks_(is_a ? unroll_a / 16 : 1)
+    , ker_(nullptr) {}
+
+// Panel contiguous along w: merge two rows of k into one row of pairs.
+void jit_avx512_core_s16_copy_kern::interleave_loop(int nchunks) {
+    Label l_pair_loop, l_tail, l_end;
+
+    auto store = [&](int c, const Zmm &z) {
+        if (is_a_)
+            vmovups(ptr[reg_dst_ + c * 64], z);
+        else
+            vmovups(ptr[reg_dst_ + c * 64] | Opmask(c + 1), z);
+    };
+
+    mov(reg_loop_, reg_k_);
+    sar(reg_loop_, 1);
+    jz(l_tail, T_NEAR);
+
+    L(l_pair_loop); {
+        for (int c = 0; c < nchunks; c++) {
+            Zmm lo(2 * c), hi(2 * c + 1);
+            vpmovzxwd(lo | Opmask(c + 1) | T_z, ptr[reg_src_ + c * 32]);
+            vpmovzxwd(hi | Opmask(c + 1) | T_z,
+                    ptr[reg_src_ + reg_ld_ + c * 32]);
+            vpslld(hi, hi, 16);
+            vpord(lo, lo, hi);
+            store(c, lo);
+        }
+        lea(reg_src_, ptr[reg_src_ + reg_ld_ * 2]);
+        add(reg_dst_, reg_dst_stride_);
+        dec(reg_loop_);
+        jnz(l_pair_loop, T_NEAR);
+    }
+
+    L(l_tail);
+    test(reg_k_, 1);
+    jz(l_end, T_NEAR);
+
+    for (int c = 0; c < nchunks; c++) {
+        Zmm lo(2 * c);
+        vpmovzxwd(lo | Opmask(c + 1) | T_z, ptr[reg_src_ + c * 32]);
+        store(c, lo);
+    }
+
+    L(l_end);
+}
+
+// Panel contiguous along k: every pair already is a dword in memory, so
+// transpose them with a gather over the w rows (columns).
+void jit_avx512_core_s16_copy_kern::gather_loop(int nchunks) {
+    Label l_pair_loop, l_tail, l_row_loop, l_end;
+
+    auto store = [&](int c, const Zmm &z) {
+        if (is_a_)
+            vmovups(ptr[reg_dst_ + c * 64], z);
+        else
+            vmovups(ptr[reg_dst_ + c * 64] | Opmask(c + 1), z);
+    };
+
+    Zmm zmm_ld(30), zmm_iota(31), zmm_tmp(29);
+    vpbroadcastd(zmm_ld, reg_ld_.cvt32());
+    vmovdqu32(zmm_iota, ptr[rip + l_iota_]);
+    for (int c = 0; c < nchunks; c++) {
+        Zmm idx(16 + c);
+        mov(reg_tmp_.cvt32(), 16 * c);
+        vpbroadcastd(zmm_tmp, reg_tmp_.cvt32());
+        vpaddd(idx, zmm_iota, zmm_tmp);
+        vpmulld(idx, idx, zmm_ld);
+    }
+
+    mov(reg_aux_, reg_src_);
+    mov(reg_loop_, reg_k_);
+    sar(reg_loop_, 1);
+    jz(l_tail, T_NEAR);
+
+    L(l_pair_loop); {
+        for (int c = 0; c < nchunks; c++) {
+            Zmm z(c);
+            vpxord(z, z, z);
+            kmovw(Opmask(4 + c), Opmask(c + 1));
+            vpgatherdd(z | Opmask(4 + c), ptr[reg_aux_ + Zmm(16 + c)]);
+            store(c, z);
+        }
+        add(reg_aux_, 4);
+        add(reg_dst_, reg_dst_stride_);
+        dec(reg_loop_);
+        jnz(l_pair_loop, T_NEAR);
+    }
+
+    L(l_tail);
+    test(reg_k_, 1);
+    jz(l_end, T_NEAR);
+
+    // The last k is copied word by word: reading it as a dword could touch
+    // memory past the end of the last row.
+    if (is_a_) {
+        Zmm z(0);
+        vpxord(z, z, z);
+        for (int c = 0; c < nchunks; c++)
+            store(c, z);
+    }
+    mov(reg_k_, reg_dst_);
+    mov(reg_loop_, reg_w_);
+    L(l_row_loop); {
+        movzx(reg_tmp_.cvt32(), word[reg_aux_]);
+        mov(dword[reg_k_], reg_tmp_.cvt32());
+        add(reg_aux_, reg_ld_);
+        add(reg_k_, 4);
+        dec(reg_loop_);
+        jnz(l_row_loop, T_NEAR);
+    }
+
+    L(l_end);
+}
+
+void jit_avx512_core_s16_copy_kern::generate() {
+    preamble();
+
+    mov(reg_src_, ptr[param_ + GET_OFF(src)]);
+    mov(reg_dst_, ptr[param_ + GET_OFF(dst)]);
+    mov(reg_ld_, ptr[param_ + GET_OFF(ld)]);
+    mov(reg_k_, ptr[param_ + GET_OFF(k)]);
+    mov(reg_w_, ptr[param_ + GET_OFF(w)]);
+
+    shl(reg_ld_, 1);
+
+    // Bytes between consecutive pairs: panels of A are padded to 16 rows.
+    mov(reg_dst_stride_, reg_w_);
+    if (is_a_) {
+        add(reg_dst_stride_, 15);
+        and_(reg_dst_stride_, ~15);
+    }
+    shl(reg_dst_stride_, 2);
+
+    // Per-chunk masks of valid rows (columns) in k1..k3.
+    for (int c = 0; c < max_chunks_; c++) {
+        xor_(reg_tmp_, reg_tmp_);
+        mov(reg_aux_, reg_w_);
+        sub(reg_aux_, 16 * c);
+        cmovs(reg_aux_, reg_tmp_);
+        mov(reg_tmp_, 16);
+        cmp(reg_aux_, reg_tmp_);
+        cmovg(reg_aux_, reg_tmp_);
+        mov(reg_tmp_, -1);
+        bzhi(reg_tmp_, reg_tmp_, reg_aux_);
+        kmovw(Opmask(c + 1), reg_tmp_.cvt32());
+    }
+
+    Label l_chunks[3], l_end;
+    for (int nc = max_chunks_; nc > 0; nc--) {
+        L(l_chunks[nc - 1]);
+        if (nc > 1) {
+            cmp(reg_w_, 16 * (nc - 1));
+            jle(l_chunks[nc - 2], T_NEAR);
+        }
+        if (interleave_)
+            interleave_loop(nc);
+        else
+            gather_loop(nc);
+        jmp(l_end, T_NEAR);
+    }
+    L(l_end);
+
+    postamble();
+
+    if (!interleave_) {
+        align(64);
+        L(l_iota_);
+        for (int i = 0; i < 16; i++)
+            dd(i);
+    }
+
+    ker_ = getCode<decltype(ker_)>();
+}
+
+}
+}
+}
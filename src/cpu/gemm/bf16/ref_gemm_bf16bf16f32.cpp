@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ref_gemm_bf16bf16f32.hpp"
+
+#include "../f32/ref_gemm_f32.hpp"
+#include "mkldnn_thread.hpp"
+#include "mkldnn_types.h"
+#include "nstl.hpp"
+#include "utils.hpp"
+
+#include "jit_generator.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+mkldnn_status_t ref_gemm_bf16bf16f32(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *alpha,
+        const bfloat16_t *A, const int *LDA, const bfloat16_t *B,
+        const int *LDB, const float *beta, float *C, const int *LDC) {
+
+    if (*M == 0 || *N == 0)
+        return mkldnn_success;
+
+    bool AisN = (*transa == 'N' || *transa == 'n');
+    bool BisN = (*transb == 'N' || *transb == 'n');
+
+    int m = *M, n = *N, k = *K, lda = *LDA, ldb = *LDB;
+    const int a_cols = AisN ? k : m;
+    const int b_cols = BisN ? n : k;
+    size_t sizeA = (size_t)lda * a_cols;
+    size_t sizeB = (size_t)ldb * b_cols;
+
+    float *fA = (float *)malloc(nstl::max(sizeA, (size_t)1) * sizeof(float),
+            PAGE_4K);
+    float *fB = (float *)malloc(nstl::max(sizeB, (size_t)1) * sizeof(float),
+            PAGE_4K);
+
+    if (utils::any_null(fA, fB)) {
+        free(fA);
+        free(fB);
+        return mkldnn_out_of_memory;
+    }
+
+    parallel_nd(a_cols, [&](int j) {
+        cvt_bfloat16_to_float(&fA[(size_t)j * lda], &A[(size_t)j * lda], lda);
+    });
+    parallel_nd(b_cols, [&](int j) {
+        cvt_bfloat16_to_float(&fB[(size_t)j * ldb], &B[(size_t)j * ldb], ldb);
+    });
+
+    mkldnn_status_t status = ref_gemm<float>(transa, transb, M, N, K, alpha,
+            fA, LDA, fB, LDB, beta, C, LDC, nullptr);
+
+    free(fA);
+    free(fB);
+    return status;
+}
+
+}
+}
+}
@@ -0,0 +1,36 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef REF_GEMM_BF16BF16F32_HPP
+#define REF_GEMM_BF16BF16F32_HPP
+
+#include "mkldnn_types.h"
+
+#include "bfloat16.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+mkldnn_status_t ref_gemm_bf16bf16f32(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *alpha,
+        const bfloat16_t *A, const int *LDA, const bfloat16_t *B,
+        const int *LDB, const float *beta, float *C, const int *LDC);
+
+}
+}
+}
+#endif // REF_GEMM_BF16BF16F32_HPP
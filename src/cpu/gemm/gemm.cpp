@@ -28,6 +28,8 @@
 #include "f32/jit_avx_gemm_f32.hpp"
 #include "f32/ref_gemm_f32.hpp"
 
+#include "bf16/jit_avx512_core_gemm_bf16bf16f32.hpp"
+#include "bf16/ref_gemm_bf16bf16f32.hpp"
 #include "gemm_driver.hpp"
 #include "s8x8s32/ref_gemm_s8x8s32.hpp"
 #include "s8x8s32/simple_gemm_s8s8s32.hpp"
@@ -258,6 +260,30 @@ mkldnn_status_t gemm_s8x8s32(const char *transa, const char *transb,
         const uint8_t *B, const int *LDB, const int8_t *bo, const float *beta,
         int32_t *C, const int *LDC, const int32_t *co);
 
+mkldnn_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *alpha,
+        const bfloat16_t *A, const int *lda, const bfloat16_t *B,
+        const int *ldb, const float *beta, float *C, const int *ldc) {
+    mkldnn_status_t status = check_gemm_input(transa, transb, M, N, K,
+            lda, ldb, ldc, alpha, beta, false);
+    if (status != mkldnn_success)
+        return status;
+
+    if (*M == 0 || *N == 0)
+        return mkldnn_success;
+
+    if (mayiuse(avx512_core))
+        status = jit_avx512_core_gemm_bf16bf16f32(transa, transb, M, N, K,
+                alpha, A, lda, B, ldb, beta, C, ldc);
+    else
+        status = ref_gemm_bf16bf16f32(transa, transb, M, N, K, alpha,
+                A, lda, B, ldb, beta, C, ldc);
+
+    if (status == mkldnn_success)
+        msan_unpoison_matrix(C, *M, *N, *ldc, sizeof(*C));
+    return status;
+}
+
 }
 }
 }
@@ -309,3 +335,19 @@ mkldnn_status_t mkldnn_gemm_s8s8s32(const char *transa, const char *transb,
     return gemm_s8x8s32<int8_t>(transa, transb, offsetc, &M_s32, &N_s32, &K_s32,
             alpha, A, &lda_s32, ao, B, &ldb_s32, bo, beta, C, &ldc_s32, co);
 }
+
+mkldnn_status_t mkldnn_gemm_bf16bf16f32(const char *transa, const char *transb,
+        const int64_t *M, const int64_t *N, const int64_t *K, const float *alpha,
+        const uint16_t *A, const int64_t *lda, const uint16_t *B,
+        const int64_t *ldb, const float *beta, float *C, const int64_t *ldc) {
+    int M_s32 = (int)*M;
+    int N_s32 = (int)*N;
+    int K_s32 = (int)*K;
+    int lda_s32 = (int)*lda;
+    int ldb_s32 = (int)*ldb;
+    int ldc_s32 = (int)*ldc;
+
+    return gemm_bf16bf16f32(transa, transb, &M_s32, &N_s32, &K_s32, alpha,
+            (const bfloat16_t *)A, &lda_s32, (const bfloat16_t *)B, &ldb_s32,
+            beta, C, &ldc_s32);
+}
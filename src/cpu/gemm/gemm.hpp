@@ -20,6 +20,8 @@
 #include "mkldnn_types.h"
 #include "os_blas.hpp"
 
+#include "bfloat16.hpp"
+
 namespace mkldnn {
 namespace impl {
 namespace cpu {
@@ -37,6 +39,11 @@ mkldnn_status_t gemm_s8x8s32(const char *transa, const char *transb,
         const b_dt *B, const int *ldb, const int8_t *bo, const float *beta,
         int32_t *c, const int *ldc, const int32_t *co);
 
+mkldnn_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *alpha,
+        const bfloat16_t *A, const int *lda, const bfloat16_t *B,
+        const int *ldb, const float *beta, float *C, const int *ldc);
+
 #ifdef USE_CBLAS
 #define GEMM_IMPL_STR "gemm:blas"
 #else
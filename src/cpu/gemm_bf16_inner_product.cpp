@@ -0,0 +1,202 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "c_types_map.hpp"
+#include "mkldnn_thread.hpp"
+#include "type_helpers.hpp"
+
+#include "bfloat16.hpp"
+
+#include "gemm_bf16_inner_product.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace mkldnn::impl::status;
+using namespace mkldnn::impl::prop_kind;
+using namespace mkldnn::impl::data_type;
+using namespace mkldnn::impl::format_tag;
+using namespace mkldnn::impl::primitive_kind;
+using namespace memory_tracking::names;
+
+namespace {
+void cvt_acc_to_bf16(bfloat16_t *dst, const float *acc, size_t nelems) {
+    parallel(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        balance211(nelems, nthr, ithr, start, end);
+        if (end > start)
+            cvt_float_to_bfloat16(dst + start, acc + start, end - start);
+    });
+}
+}
+
+template <data_type_t dst_data_type>
+void gemm_bf16_inner_product_fwd_t<dst_data_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, MKLDNN_ARG_SRC);
+    auto weights = CTX_IN_MEM(const wei_data_t *, MKLDNN_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, MKLDNN_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(dst_data_t *, MKLDNN_ARG_DST);
+
+    const int MB = pd()->MB();
+    const int OC = pd()->OC();
+    const int IC = pd()->IC_total_padded();
+
+    bool wei_tr = !memory_desc_matches_one_of_tag(
+            *pd()->weights_md(), hwio, dhwio, io);
+
+    const float *scales = pd()->attr()->output_scales_.scales_;
+
+    acc_data_t *acc = pd()->dst_is_acc_
+        ? (acc_data_t *)dst
+        : scratchpad(ctx).template get<acc_data_t>(key_iprod_int_dat_in_acc_dt);
+
+    float alpha = 1.0;
+    gemm_bf16bf16f32(wei_tr ? "T" : "N", "N", &OC, &MB, &IC, &alpha, weights,
+            wei_tr ? &IC : &OC, src, &IC, &beta_, acc, &OC);
+
+    if (postops_in_ip_) {
+        const bool force_sequential = MB * OC < 2000;
+        parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
+            size_t start, end;
+            balance211((size_t)OC * MB, nthr, ithr, start, end);
+            (*pp_kernel_)(dst, acc, bias, scales, start, end);
+        });
+    }
+}
+
+template <data_type_t diff_src_data_type>
+void gemm_bf16_inner_product_bwd_data_t<diff_src_data_type>::
+execute_backward_data(const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, MKLDNN_ARG_DIFF_DST);
+    auto weights = CTX_IN_MEM(const wei_data_t *, MKLDNN_ARG_WEIGHTS);
+    auto diff_src = CTX_OUT_MEM(diff_src_data_t *, MKLDNN_ARG_DIFF_SRC);
+
+    const int MB = pd()->MB();
+    const int OC = pd()->OC();
+    const int IC = pd()->IC_total_padded();
+
+    bool wei_tr = memory_desc_matches_one_of_tag(
+            *pd()->weights_md(), hwio, dhwio, io);
+
+    acc_data_t *acc = pd()->diff_src_is_acc_
+        ? (acc_data_t *)diff_src
+        : scratchpad(ctx).template get<acc_data_t>(key_iprod_int_dat_in_acc_dt);
+
+    float alpha = 1.0, beta = 0.0;
+    gemm_bf16bf16f32(wei_tr ? "T" : "N", "N", &IC, &MB, &OC, &alpha, weights,
+            wei_tr ? &OC : &IC, diff_dst, &OC, &beta, acc, &IC);
+
+    if (!pd()->diff_src_is_acc_)
+        cvt_acc_to_bf16((bfloat16_t *)diff_src, acc, (size_t)IC * MB);
+}
+
+template <data_type_t diff_wei_data_type>
+void gemm_bf16_inner_product_bwd_weights_t<diff_wei_data_type>::
+execute_backward_weights(const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, MKLDNN_ARG_DIFF_DST);
+    auto src = CTX_IN_MEM(const src_data_t *, MKLDNN_ARG_SRC);
+    auto diff_weights = CTX_OUT_MEM(diff_wei_data_t *, MKLDNN_ARG_DIFF_WEIGHTS);
+
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+
+    diff_dst += diff_dst_d.offset0();
+
+    const int MB = pd()->MB();
+    const int OC = pd()->OC();
+    const int IC = pd()->IC_total_padded();
+
+    bool wei_tr = memory_desc_matches_one_of_tag(
+            *pd()->diff_weights_md(), hwio, dhwio, io);
+
+    acc_data_t *acc = pd()->diff_wei_is_acc_
+        ? (acc_data_t *)diff_weights
+        : scratchpad(ctx).template get<acc_data_t>(key_iprod_int_dat_in_acc_dt);
+
+    float alpha = 1.0, beta = 0.0;
+    if (wei_tr)
+        gemm_bf16bf16f32("N", "T", &OC, &IC, &MB, &alpha, diff_dst, &OC, src,
+                &IC, &beta, acc, &OC);
+    else
+        gemm_bf16bf16f32("N", "T", &IC, &OC, &MB, &alpha, src, &IC, diff_dst,
+                &OC, &beta, acc, &IC);
+
+    if (!pd()->diff_wei_is_acc_)
+        cvt_acc_to_bf16((bfloat16_t *)diff_weights, acc, (size_t)IC * OC);
+
+    execute_backward_bias(ctx);
+}
+
+template <data_type_t diff_wei_data_type>
+void gemm_bf16_inner_product_bwd_weights_t<diff_wei_data_type>::
+execute_backward_bias(const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, MKLDNN_ARG_DIFF_DST);
+    auto diff_bias = CTX_OUT_MEM(char *, MKLDNN_ARG_DIFF_BIAS);
+    if (!diff_bias) return;
+
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper diff_bias_d(pd()->diff_weights_md(1));
+
+    diff_dst += diff_dst_d.offset0();
+    diff_bias += diff_bias_d.data_type_size() * diff_bias_d.offset0();
+
+    const int MB = pd()->MB();
+    const int OC = pd()->OC();
+    const bool diff_bias_is_acc = diff_bias_d.data_type() == f32;
+
+    // The reduction over the minibatch is done in f32 for blocks of oc
+    constexpr int blksize = 16;
+    const int OC_blocks = utils::div_up(OC, blksize);
+    parallel(0, [&](const int ithr, const int nthr) {
+        int ocb_start{0}, ocb_end{0};
+        balance211(OC_blocks, nthr, ithr, ocb_start, ocb_end);
+
+        for (int ocb = ocb_start; ocb < ocb_end; ++ocb) {
+            const int oc_s = ocb * blksize;
+            const int len = nstl::min(blksize, OC - oc_s);
+
+            acc_data_t db[blksize] = {0};
+            for (int mb = 0; mb < MB; ++mb) {
+                const diff_dst_data_t *dd = &diff_dst[mb * OC + oc_s];
+                PRAGMA_OMP_SIMD()
+                for (int i = 0; i < len; ++i)
+                    db[i] += (float)dd[i];
+            }
+
+            if (diff_bias_is_acc) {
+                float *d = (float *)diff_bias + oc_s;
+                for (int i = 0; i < len; ++i)
+                    d[i] = db[i];
+            } else {
+                cvt_float_to_bfloat16((bfloat16_t *)diff_bias + oc_s, db, len);
+            }
+        }
+    });
+}
+
+template struct gemm_bf16_inner_product_fwd_t<f32>;
+template struct gemm_bf16_inner_product_fwd_t<bf16>;
+template struct gemm_bf16_inner_product_bwd_data_t<f32>;
+template struct gemm_bf16_inner_product_bwd_data_t<bf16>;
+template struct gemm_bf16_inner_product_bwd_weights_t<f32>;
+template struct gemm_bf16_inner_product_bwd_weights_t<bf16>;
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
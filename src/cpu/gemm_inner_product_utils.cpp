@@ -101,6 +101,14 @@ void pp_kernel_t<acc_type, dst_type>::generate()
 
     const size_t vlen = cpu_isa_traits<avx512_common>::vlen / sizeof(float);
 
+    // vcvtneps2bf16 emulation occupies the upper four registers
+    const bool do_bf16_emu = dst_type == data_type::bf16
+        && !mayiuse(avx512_core_bf16);
+    bf16_emulation_t *bf16_emu = nullptr;
+    if (do_bf16_emu)
+        bf16_emu = new bf16_emulation_t(this, Zmm(31), Zmm(30), Zmm(29),
+                reg_tmp, Zmm(28));
+
     Zmm vreg_zero = Zmm(0);
     Zmm vreg_scale = Zmm(1);
     Zmm vreg_sum_scale = Zmm(2);
@@ -133,6 +141,9 @@ void pp_kernel_t<acc_type, dst_type>::generate()
     if (dst_type == data_type::u8)
         vxorps(vreg_zero, vreg_zero, vreg_zero);
 
+    if (do_bf16_emu)
+        bf16_emu->init_vcvtneps2bf16();
+
     // Load accumulated value, convert to float, apply bias (if any), scaling,
     // and eltwise (if any); then convert to destination type and store
     auto compute = [&](size_t offset, int idx, bool apply_mask) {
@@ -173,9 +184,14 @@ void pp_kernel_t<acc_type, dst_type>::generate()
             case data_type::f32:
                 vmovups(vreg_bias_, bias_addr);
                 break;
+            case data_type::bf16:
+                vpmovzxwd(vreg_bias_, bias_addr);
+                vpslld(vreg_bias(idx), vreg_bias(idx), 16);
+                break;
             default: assert(!"unimplemented");
             }
-            if (bias_data_type_ != data_type::f32)
+            if (!utils::one_of(bias_data_type_, data_type::f32,
+                        data_type::bf16))
                 vcvtdq2ps(vreg_bias(idx), vreg_bias(idx));
             vaddps(vreg_dst(idx), vreg_dst(idx), vreg_bias(idx));
         }
@@ -193,9 +209,13 @@ void pp_kernel_t<acc_type, dst_type>::generate()
             case data_type::s32: vmovups(vreg_prev_dst_, dst_addr); break;
             case data_type::s8: vpmovsxbd(vreg_prev_dst_, dst_addr); break;
             case data_type::u8: vpmovzxbd(vreg_prev_dst_, dst_addr); break;
+            case data_type::bf16:
+                vpmovzxwd(vreg_prev_dst_, dst_addr);
+                vpslld(vreg_prev_dst(idx), vreg_prev_dst(idx), 16);
+                break;
             default: assert(!"unsupported data type");
             }
-            if (dst_type != data_type::f32)
+            if (!utils::one_of(dst_type, data_type::f32, data_type::bf16))
                 vcvtdq2ps(vreg_prev_dst(idx), vreg_prev_dst(idx));
 
             vfmadd231ps(vreg_dst(idx), vreg_prev_dst(idx), vreg_sum_scale);
@@ -207,7 +227,7 @@ void pp_kernel_t<acc_type, dst_type>::generate()
         if (dst_type == data_type::u8)
             vmaxps(vreg_dst(idx), vreg_dst(idx), vreg_zero);
 
-        if (dst_type != data_type::f32) {
+        if (!utils::one_of(dst_type, data_type::f32, data_type::bf16)) {
             vcvtps2dq(vreg_dst(idx), vreg_dst(idx));
         }
 
@@ -222,6 +242,18 @@ void pp_kernel_t<acc_type, dst_type>::generate()
         case data_type::s32:
             vmovups(dst_addr, vreg_dst_);
             break;
+        case data_type::bf16: {
+            Ymm yreg_dst = Ymm(vreg_dst(idx).getIdx());
+            if (do_bf16_emu)
+                bf16_emu->vcvtneps2bf16(yreg_dst, vreg_dst(idx));
+            else
+                vcvtneps2bf16(yreg_dst, vreg_dst(idx));
+            if (apply_mask)
+                vmovdqu16(dst_addr | kreg_rem_mask, yreg_dst);
+            else
+                vmovdqu16(dst_addr, yreg_dst);
+            break;
+        }
         default: assert(!"unimplemented");
         }
     };
@@ -321,6 +353,8 @@ void pp_kernel_t<acc_type, dst_type>::generate()
         L(main_loop); {
             size_t def_unroll = 4;
             size_t max_unroll = do_sum_ ? 9 : 13;
+            if (do_bf16_emu)
+                max_unroll = do_sum_ ? 8 : 12;
 
             size_t OC_loop, OC_tail;
             if (OC_ < max_unroll * vlen) {
@@ -403,6 +437,8 @@ void pp_kernel_t<acc_type, dst_type>::generate()
     if (do_eltwise_)
         eltwise_injector_->prepare_table();
 
+    delete bf16_emu;
+
     ker_ = getCode<decltype(ker_)>();
 }
 
@@ -451,6 +487,7 @@ template class pp_kernel_t<s32, f32>;
 template class pp_kernel_t<s32, s32>;
 template class pp_kernel_t<s32, s8>;
 template class pp_kernel_t<s32, u8>;
+template class pp_kernel_t<f32, bf16>;
 }
 
 }
@@ -122,7 +122,7 @@ struct gemm_x8s8s32x_inner_product_fwd_t: public cpu_primitive_t {
     };
 
     gemm_x8s8s32x_inner_product_fwd_t(const pd_t *apd)
-        : cpu_primitive_t(apd, true) {
+        : cpu_primitive_t(apd) {
         pp_kernel_ = new inner_product_utils::pp_kernel_t<data_type::s32,
                 dst_type>(apd, false);
     }
@@ -187,7 +187,7 @@ void jit_avx512_common_1x1_conv_kernel::reduce_loop(int load_loop_blk,
         if (one_of(jcp.prop_kind, forward_training, forward_inference,
                    backward_data))
             return EVEX_compress_addr(aux_reg_output_data,
-                    (i_load * jcp.bcast_dim + i_ur) * jcp.load_block
+                    (i_load * output_load_stride() + i_ur) * jcp.load_block
                     * jcp.typesize_out);
         else
             return ptr[aux_reg_output_data +
@@ -481,7 +481,7 @@ void jit_avx512_common_1x1_conv_kernel::generate()
             add(reg_bias_data,
                 load_loop_blk * jcp.load_block * jcp.typesize_out);
             add(reg_output_data,
-                load_loop_blk * jcp.bcast_dim * jcp.load_block *
+                load_loop_blk * output_load_stride() * jcp.load_block *
                     jcp.typesize_out);
             break;
         case backward_data:
@@ -573,6 +573,23 @@ bool jit_avx512_common_1x1_conv_kernel::post_ops_ok(
     auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
     auto is_sum = [&](int idx) { return p.entry_[idx].is_sum(); };
 
+    /* scale_shift and binary entries are not applied by this kernel, neither
+     * before nor after a fused depthwise convolution */
+    for (int idx = 0; idx < p.len_; idx++)
+        if (p.entry_[idx].is_scale_shift() || p.entry_[idx].is_binary())
+            return false;
+
+    /* the post-ops following a fused depthwise convolution are checked by
+     * its own kernel, and there is nothing to sum with before it */
+    const int dw_conv_ind = p.find(primitive_kind::convolution);
+    if (dw_conv_ind != -1) {
+        switch (dw_conv_ind) {
+        case 0: return true; // dw_conv
+        case 1: return is_eltwise(0); // eltwise -> dw_conv
+        default: return false;
+        }
+    }
+
     switch (p.len_) {
     case 0: return true; // no post_ops
     case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
@@ -636,14 +653,29 @@ status_t jit_avx512_common_1x1_conv_kernel::init_conf(jit_1x1_conv_conf_t &jcp,
         return status::unimplemented;
 
     const auto &p = attr.post_ops_;
-    jcp.with_sum = p.find(primitive_kind::sum) != -1;
-    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    const int dw_conv_ind = p.find(primitive_kind::convolution);
+    jcp.with_dw_conv = dw_conv_ind != -1;
+    const int post_ops_1x1_len = jcp.with_dw_conv ? dw_conv_ind : p.len_;
+    jcp.with_sum = p.find(primitive_kind::sum, 0, post_ops_1x1_len) != -1;
+    const int eltwise_ind
+        = p.find(primitive_kind::eltwise, 0, post_ops_1x1_len);
     jcp.with_eltwise = eltwise_ind != -1;
     if (jcp.with_eltwise) {
         jcp.eltwise = p.entry_[eltwise_ind].eltwise;
         if (dst_d.data_type() == data_type::s32) return status::unimplemented;
     }
 
+    if (jcp.with_dw_conv) {
+        /* the depthwise kernel works on whole blocks of channels */
+        bool dw_conv_ok = true
+            && one_of(jcp.prop_kind, forward_training, forward_inference)
+            && ndims == 4
+            && jcp.ngroups == 1
+            && !reduce_src
+            && jcp.oc_without_padding % simd_w == 0;
+        if (!dw_conv_ok) return status::unimplemented;
+    }
+
     auto dat_tag = pick(ndims - 3, nCw16c, nChw16c);
     jcp.src_tag = src_d.matches_one_of_tag(dat_tag);
     jcp.dst_tag = dst_d.matches_one_of_tag(dat_tag);
@@ -786,6 +818,8 @@ status_t jit_avx512_common_1x1_conv_kernel::init_conf(jit_1x1_conv_conf_t &jcp,
             jcp.expl_bcast = false;
             jcp.use_vmovntps = true;
         }
+        /* the buffer feeding the fused depthwise convolution stays in cache */
+        if (jcp.with_dw_conv) jcp.use_vmovntps = false;
         jcp.ur = 1;
         for (int ur_w = max_regs; ur_w >= min_regs; ur_w -= ur_step) {
             if ((spatial >= size_treshold && spatial % ur_w == 0)
@@ -1127,7 +1161,9 @@ status_t jit_avx512_common_1x1_conv_kernel::init_conf(jit_1x1_conv_conf_t &jcp,
     assert(jcp.bcast_block % jcp.ur == 0);
     assert(jcp.reduce_dim % jcp.reduce_block == 0);
 
-    jcp.ur_tail = jcp.bcast_dim % jcp.ur;
+    /* with a fused depthwise convolution the output rows go to a buffer,
+     * so the kernel is called for one row at a time unless it has no tail */
+    jcp.ur_tail = (jcp.with_dw_conv ? jcp.ow : jcp.bcast_dim) % jcp.ur;
 
     jcp.nb_bcast_blocking = bcast_blocking / jcp.bcast_block;
     jcp.nb_bcast_blocking_max = bcast_blocking_max / jcp.bcast_block;
@@ -69,6 +69,13 @@ struct jit_avx512_common_1x1_conv_kernel : public jit_generator {
     using reg64_t = const Xbyak::Reg64;
     using zmm_t = const Xbyak::Zmm;
 
+    /* distance between the output channel blocks; with a fused depthwise
+     * convolution the output goes to a buffer of dw_conv_buffer_oh rows */
+    int output_load_stride() const {
+        return jcp.with_dw_conv ? jcp.dw_conv_buffer_oh * jcp.ow
+            : jcp.bcast_dim;
+    }
+
     reg64_t reg_bcast_data = r8;
     reg64_t reg_load_data = r10;
     reg64_t reg_output_data = r9;
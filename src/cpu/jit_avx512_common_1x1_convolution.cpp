@@ -252,6 +252,153 @@ execute_forward_thr(const int ithr, const int nthr, const src_data_t *src,
 }
 
 
+/* The 1x1 convolution computes a few rows of its output for a chunk of
+ * channel blocks into a per-thread buffer, and the fused depthwise
+ * convolution immediately turns them into rows of the final output. */
+template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type>
+void jit_avx512_common_1x1_convolution_fwd_t<src_type, wei_type, dst_type>::
+execute_forward_fusion(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, MKLDNN_ARG_SRC);
+    auto weights = CTX_IN_MEM(const wei_data_t *, MKLDNN_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const dst_data_t *, MKLDNN_ARG_BIAS);
+    auto weights_dw = CTX_IN_MEM(const float *,
+            MKLDNN_ARG_ATTR_POST_OP_DW | MKLDNN_ARG_WEIGHTS);
+    auto bias_dw = CTX_IN_MEM(const float *,
+            MKLDNN_ARG_ATTR_POST_OP_DW | MKLDNN_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, MKLDNN_ARG_DST);
+
+    auto buffer = this->scratchpad(ctx).template get<dst_data_t>(
+            key_fusion_inout_buffer);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper weights_dw_d(pd()->weights_md(2));
+
+    const auto &jcp = kernel_->jcp;
+    const auto &jcp_dw = kernel_dw_->jcp;
+
+    const int buffer_oh = jcp.dw_conv_buffer_oh;
+    const int dw_rows = buffer_oh - 2;
+    const int nb_oh = div_up(jcp.oh, dw_rows);
+    const int nb_chunks = div_up(jcp.nb_load, jcp_dw.nb_ch_blocking);
+    const size_t buffer_row_size = (size_t)jcp.ow * jcp.oc_block;
+    const size_t buffer_per_thr
+        = jcp_dw.nb_ch_blocking * buffer_oh * buffer_row_size;
+    const int work_amount = jcp.mb * nb_chunks * nb_oh;
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        int start{0}, end{0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        dst_data_t *thr_buffer = buffer + ithr * buffer_per_thr;
+        auto p = jit_1x1_conv_call_s();
+
+        auto conv_1x1 = [&](int n, int ocb, int ocb_num, int ih, int nrows,
+                dst_data_t *out) {
+            p.bcast_dim = nrows * jcp.ow;
+            p.load_dim = ocb_num * jcp.oc_block;
+            p.output_data = out;
+            p.bias_data = &bias[ocb * jcp.oc_block];
+
+            for (int icb = 0; icb < jcp.nb_reduce;
+                    icb += jcp.nb_reduce_blocking) {
+                const int icb_step = nstl::min(jcp.nb_reduce_blocking,
+                        jcp.nb_reduce - icb);
+                p.first_last_flag = 0
+                    | (icb == 0 ? FLAG_REDUCE_FIRST : 0)
+                    | (icb + icb_step >= jcp.nb_reduce
+                            ? FLAG_REDUCE_LAST : 0);
+                p.reduce_dim = this_block_size(icb * jcp.ic_block, jcp.ic,
+                        icb_step * jcp.ic_block);
+                p.load_data = &weights[weights_d.blk_off(ocb, icb)];
+                p.bcast_data = &src[src_d.blk_off(n, icb, ih, 0)];
+
+                kernel_->jit_ker(&p);
+            }
+        };
+
+        auto conv_dw = [&](int n, int ocb, int ocb_num, int oh,
+                const dst_data_t *src_row) {
+            /* the input of the depthwise convolution has oh rows */
+            const int i_t_overflow = nstl::max(0, jcp_dw.t_pad - oh);
+            const int i_b_overflow = nstl::max(jcp.oh,
+                    oh + jcp_dw.kh - jcp_dw.t_pad) - jcp.oh;
+            const int kh = i_t_overflow;
+            const int kh_padding = jcp_dw.kh - i_t_overflow - i_b_overflow;
+
+            auto ker = [&](int ur_w_step, int ow) {
+                auto par_conv = jit_conv_call_s();
+
+                const int i_l_overflow = nstl::max(0, jcp_dw.l_pad - ow);
+                const int i_r_overflow = nstl::max(jcp_dw.iw,
+                        ow + jcp_dw.kw - jcp_dw.l_pad) - jcp_dw.iw;
+                const int iw = nstl::max(ow - jcp_dw.l_pad, 0);
+                const int kw = i_l_overflow;
+                const int kw_padding
+                    = jcp_dw.kw - i_l_overflow - i_r_overflow;
+
+                par_conv.src = src_row + iw * jcp_dw.ch_block;
+                par_conv.dst = &dst[dst_d.blk_off(n, ocb, oh, ow)];
+                par_conv.filt
+                    = &weights_dw[weights_dw_d.blk_off(ocb, 0, 0, kh, kw)];
+                if (bias_dw) par_conv.bias = &bias_dw[ocb * jcp_dw.ch_block];
+
+                par_conv.kh_padding = (size_t)nstl::max(0, kh_padding);
+                par_conv.kw_padding = (size_t)nstl::max(0, kw_padding);
+                par_conv.ur_w = (size_t)ur_w_step;
+                par_conv.ch_blocks = ocb_num;
+
+                kernel_dw_->jit_ker(&par_conv);
+            };
+
+            int ow = 0;
+            const int l_border = nstl::min(jcp_dw.l_pad, jcp_dw.ow);
+            for (; ow < l_border; ow++)
+                ker(1, ow);
+
+            const int ur_w_step = jcp_dw.iw - jcp_dw.kw + jcp_dw.l_pad - ow + 1;
+            if (ur_w_step > 0) {
+                ker(ur_w_step, ow);
+                ow += ur_w_step;
+            }
+
+            for (; ow < jcp_dw.ow; ow++)
+                ker(1, ow);
+        };
+
+        int n{0}, chunk{0}, ohb{0};
+        nd_iterator_init(start, n, jcp.mb, chunk, nb_chunks, ohb, nb_oh);
+        for (int iwork = start; iwork < end; ++iwork) {
+            const int ocb = chunk * jcp_dw.nb_ch_blocking;
+            const int ocb_num
+                = nstl::min(jcp_dw.nb_ch_blocking, jcp.nb_load - ocb);
+            const int oh_s = ohb * dw_rows;
+            const int oh_e = nstl::min(oh_s + dw_rows, jcp.oh);
+
+            /* buffer row r holds row oh_s - 1 + r of the 1x1 output */
+            auto buffer_row = [&](int ih) {
+                return thr_buffer + (ih - oh_s + 1) * buffer_row_size;
+            };
+
+            const int ih_s = nstl::max(oh_s - 1, 0);
+            const int ih_e = nstl::min(oh_e + 1, jcp.oh);
+            if (jcp.ur_tail == 0)
+                conv_1x1(n, ocb, ocb_num, ih_s, ih_e - ih_s,
+                        buffer_row(ih_s));
+            else
+                for (int ih = ih_s; ih < ih_e; ++ih)
+                    conv_1x1(n, ocb, ocb_num, ih, 1, buffer_row(ih));
+
+            for (int oh = oh_s; oh < oh_e; ++oh)
+                conv_dw(n, ocb, ocb_num, oh,
+                        buffer_row(nstl::max(oh - jcp_dw.t_pad, 0)));
+
+            nd_iterator_step(n, jcp.mb, chunk, nb_chunks, ohb, nb_oh);
+        }
+    });
+}
+
 template struct jit_avx512_common_1x1_convolution_fwd_t<data_type::f32>;
 /* convolution backward wtr data */
 
@@ -28,6 +28,7 @@
 
 #include "jit_avx512_common_1x1_conv_kernel.hpp"
 #include "jit_uni_1x1_conv_utils.hpp"
+#include "jit_uni_dw_convolution.hpp"
 #include "jit_transpose_src_utils.hpp"
 
 namespace mkldnn {
@@ -43,7 +44,16 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
                 const primitive_attr_t *attr,
                 const typename pd_t::base_class *hint_fwd_pd)
             : cpu_convolution_fwd_pd_t(engine, adesc, attr, hint_fwd_pd)
-            , jcp_(), rtus_() {}
+            , jcp_(), rtus_(), jcp_dw_(), dw_conv_pd_(nullptr) {}
+
+        pd_t(const pd_t &other)
+            : cpu_convolution_fwd_pd_t(other)
+            , jcp_(other.jcp_), rtus_(other.rtus_), jcp_dw_(other.jcp_dw_)
+            , dw_conv_pd_(other.dw_conv_pd_
+                    ? other.dw_conv_pd_->clone() : nullptr)
+        {}
+
+        ~pd_t() { delete dw_conv_pd_; }
 
         DECLARE_COMMON_PD_T(
                 JIT_IMPL_NAME_HELPER("jit_1x1:", avx512_common, ""),
@@ -60,28 +70,144 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
                 && set_default_formats();
             if (!ok) return status::unimplemented;
 
+            /* dst_md() is the output of the fused depthwise convolution, if
+             * any, so the 1x1 one is set up with dst_md_ */
             const convolution_desc_t *conv_d = desc();
             const memory_desc_t *src_d = src_md();
-            rtus_prepare(this, conv_d, src_d, dst_md());
+            rtus_prepare(this, conv_d, src_d, &dst_md_);
 
             status_t status = jit_avx512_common_1x1_conv_kernel::init_conf(
-                    jcp_, *conv_d, *src_d, *weights_md(), *dst_md(), *attr(),
+                    jcp_, *conv_d, *src_d, *weights_md(), dst_md_, *attr(),
                     mkldnn_get_max_threads(), rtus_.reduce_src_);
             if (status != status::success) return status;
 
+            if (jcp_.with_dw_conv) CHECK(depthwise_po_init());
+
             auto scratchpad = scratchpad_registry().registrar();
             jit_avx512_common_1x1_conv_kernel::init_scratchpad(scratchpad,
                     jcp_);
 
+            if (jcp_.with_dw_conv) {
+                using namespace memory_tracking::names;
+                const size_t buffer_size = (size_t)jcp_.nthr
+                    * jcp_dw_.nb_ch_blocking * jcp_dw_.ch_block
+                    * jcp_.dw_conv_buffer_oh * jcp_.ow;
+                scratchpad.book(key_fusion_inout_buffer,
+                        sizeof(dst_data_t) * buffer_size);
+            }
+
             rtus_prepare_space_info(this, scratchpad);
 
             return status::success;
         }
 
+        virtual arg_usage_t arg_usage(int arg) const override {
+            if (jcp_.with_dw_conv) {
+                if (arg == (MKLDNN_ARG_ATTR_POST_OP_DW | MKLDNN_ARG_WEIGHTS))
+                    return arg_usage_t::input;
+
+                if (arg == (MKLDNN_ARG_ATTR_POST_OP_DW | MKLDNN_ARG_BIAS)
+                        && dw_conv_pd_->with_bias())
+                    return arg_usage_t::input;
+            }
+
+            return cpu_convolution_fwd_pd_t::arg_usage(arg);
+        }
+
+        virtual const memory_desc_t *dst_md(int index = 0) const override {
+            if (index == 0 && jcp_.with_dw_conv)
+                return dw_conv_pd_->dst_md(0);
+            return cpu_convolution_fwd_pd_t::dst_md(index);
+        }
+
+        virtual const memory_desc_t *weights_md(int index = 0) const
+            override {
+            if (index >= 2 && jcp_.with_dw_conv)
+                return dw_conv_pd_->weights_md(index - 2);
+            return cpu_convolution_fwd_pd_t::weights_md(index);
+        }
+
+        virtual int n_inputs() const override {
+            return cpu_convolution_fwd_pd_t::n_inputs() + (jcp_.with_dw_conv
+                    ? dw_conv_pd_->n_inputs() - 1 : 0);
+        }
+
+        typedef typename prec_traits<dst_type>::type dst_data_t;
+        using dw_conv_pd_t = jit_avx512_common_dw_convolution_fwd_t::pd_t;
+
         jit_1x1_conv_conf_t jcp_;
         reduce_to_unit_stride_t rtus_;
+        /* the fused depthwise convolution reads ih rows of a buffer */
+        jit_conv_conf_t jcp_dw_;
+        dw_conv_pd_t *dw_conv_pd_;
 
     protected:
+        status_t depthwise_po_init() {
+            using namespace data_type;
+            using namespace format_tag;
+
+            const auto &p = attr()->post_ops_;
+            const int dw_ind = p.find(primitive_kind::convolution);
+            const auto &dw = p.entry_[dw_ind].depthwise_conv;
+
+            bool ok = true
+                && everyone_is(f32, dw.wei_dt, dw.dst_dt)
+                && one_of(dw.bias_dt, f32, data_type::undef)
+                && dw.count == 1 && dw.mask == 0 && dw.scales[0] == 1.f;
+            if (!ok) return status::unimplemented;
+
+            const dim_t oc = dst_md_.dims[1];
+            const dims_t wei_dims = {oc, 1, 1, 3, 3};
+            const dims_t bias_dims = {oc};
+            memory_desc_t wei_md, bias_md, dw_dst_md = dst_md_;
+            dw_dst_md.data_type = dw.dst_dt;
+            CHECK(mkldnn_memory_desc_init_by_tag(&wei_md, 5, wei_dims,
+                        dw.wei_dt, format_tag::any));
+            if (dw.bias_dt != data_type::undef)
+                CHECK(mkldnn_memory_desc_init_by_tag(&bias_md, 1, bias_dims,
+                            dw.bias_dt, x));
+
+            const dims_t strides = {1, 1}, dilates = {0, 0};
+            const dims_t padding = {1, 1};
+            convolution_desc_t cd;
+            CHECK(conv_desc_init(&cd, desc()->prop_kind,
+                        alg_kind::convolution_direct, &dst_md_, &wei_md,
+                        dw.bias_dt != data_type::undef ? &bias_md : nullptr,
+                        &dw_dst_md, strides, dilates, padding, padding));
+
+            /* the post-ops after the depthwise entry belong to it */
+            primitive_attr_t dw_attr;
+            for (int i = dw_ind + 1; i < p.len_; ++i) {
+                dw_attr.post_ops_.entry_.push_back(p.entry_[i]);
+                dw_attr.post_ops_.len_++;
+            }
+
+            primitive_desc_t *dw_pd = nullptr;
+            CHECK(mkldnn_primitive_desc::create<dw_conv_pd_t>(&dw_pd,
+                        (op_desc_t *)&cd, &dw_attr, engine_, nullptr));
+            dw_conv_pd_ = static_cast<dw_conv_pd_t *>(dw_pd);
+            jcp_dw_ = dw_conv_pd_->jcp_;
+
+            /* a work item computes dw_rows output rows of a chunk of
+             * nb_ch_blocking channel blocks; its 1x1 input, two rows more,
+             * should take about half of L2 */
+            const int chunk_size = jcp_dw_.nb_ch_blocking * jcp_dw_.ch_block;
+            const int nb_chunks = div_up(jcp_dw_.nb_ch,
+                    jcp_dw_.nb_ch_blocking);
+            const int L2_rows = (int)(get_cache_size(2, true)
+                    / 2 / sizeof(dst_data_t) / (jcp_.ow * chunk_size));
+            int dw_rows = nstl::max(1, nstl::min(L2_rows - 2, jcp_.oh));
+            jcp_.nthr = mkldnn_get_max_threads();
+            while (dw_rows > 1 && jcp_.mb * nb_chunks
+                    * div_up(jcp_.oh, dw_rows) < jcp_.nthr)
+                dw_rows = div_up(dw_rows, 2);
+
+            jcp_.dw_conv_buffer_oh = dw_rows + 2;
+            jcp_dw_.ih = jcp_.dw_conv_buffer_oh;
+
+            return status::success;
+        }
+
         bool set_default_formats() {
             using namespace format_tag;
 
@@ -98,15 +224,19 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
 
     jit_avx512_common_1x1_convolution_fwd_t(const pd_t *apd)
         : cpu_primitive_t(apd)
-        , kernel_(nullptr), rtus_driver_(nullptr)
+        , kernel_(nullptr), kernel_dw_(nullptr), rtus_driver_(nullptr)
     {
         kernel_ =
             new jit_avx512_common_1x1_conv_kernel(pd()->jcp_, *pd()->attr());
+        if (pd()->jcp_.with_dw_conv)
+            kernel_dw_ = new jit_uni_dw_conv_fwd_kernel_f32<avx512_common>(
+                    pd()->jcp_dw_);
         init_rtus_driver<avx512_common>(this);
     }
 
     ~jit_avx512_common_1x1_convolution_fwd_t() {
         delete kernel_;
+        delete kernel_dw_;
         delete rtus_driver_;
     }
 
@@ -115,7 +245,10 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
     typedef typename prec_traits<dst_type>::type dst_data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
+        if (pd()->jcp_.with_dw_conv)
+            execute_forward_fusion(ctx);
+        else
+            execute_forward(ctx);
         return status::success;
     }
 
@@ -125,9 +258,11 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
             const src_data_t *src, const wei_data_t *weights,
             const dst_data_t *bias, dst_data_t *dst,
             const memory_tracking::grantor_t &scratchpad) const;
+    void execute_forward_fusion(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd(); }
 
     jit_avx512_common_1x1_conv_kernel *kernel_;
+    jit_uni_dw_conv_fwd_kernel_f32<avx512_common> *kernel_dw_;
     rtus_driver_t<avx512_common> *rtus_driver_;
 };
 
@@ -91,6 +91,85 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::prepare_output(int ur_w)
         }
 }
 
+template<typename Vmm>
+void _jit_avx512_common_conv_fwd_kernel<Vmm>::apply_post_ops(int ur_w)
+{
+    const auto &p = attr_.post_ops_;
+    const size_t oc_block_size = (size_t)jcp.oc_block * typesize;
+
+    auto load_per_oc_base = [&]() {
+        mov(reg_po_off, ptr[param1 + GET_OFF(oc_l_off)]);
+        lea(reg_po_rhs, ptr[reg_po_rhs + reg_po_off * typesize]);
+    };
+
+    for (int i = 0; i < p.len_; i++) {
+        const auto &e = p.entry_[i];
+        if (e.is_eltwise()) {
+            if (ur_w == jcp.ur_w) {
+                eltwise_injectors_[i]->compute_vector_range(0,
+                        jcp.nb_oc_blocking * jcp.ur_w);
+            } else {
+                for (int k = 0; k < jcp.nb_oc_blocking; k++)
+                    eltwise_injectors_[i]->compute_vector_range(k * jcp.ur_w,
+                            k * jcp.ur_w + ur_w);
+            }
+        } else if (e.is_scale_shift()) {
+            const bool per_oc = e.scale_shift.mask != 0;
+            const size_t shifts_off = e.scale_shift.count * typesize;
+
+            mov(reg_po_rhs, reinterpret_cast<size_t>(e.scale_shift.scales));
+            if (per_oc) load_per_oc_base();
+
+            for (int k = 0; k < jcp.nb_oc_blocking; k++) {
+                const size_t off = per_oc ? k * oc_block_size : 0;
+                if (per_oc)
+                    vmovups(vmm_po_scale, EVEX_compress_addr(reg_po_rhs, off));
+                else
+                    vbroadcastss(vmm_po_scale, ptr[reg_po_rhs]);
+                for (int j = 0; j < ur_w; j++)
+                    vfmadd213ps(vmm_out(j, k), vmm_po_scale,
+                            EVEX_compress_addr(reg_po_rhs, shifts_off + off,
+                                !per_oc));
+            }
+        } else if (e.is_binary()) {
+            const auto bcast = get_binary_po_bcast(e.binary.src1_desc,
+                    jcp.ngroups * jcp.oc_without_padding);
+
+            mov(reg_po_rhs,
+                    ptr[param1 + GET_OFF(post_ops_binary_rhs_arg_vec)]);
+            mov(reg_po_rhs, ptr[reg_po_rhs + i * sizeof(void *)]);
+            if (bcast == binary_po_bcast_per_oc) {
+                load_per_oc_base();
+            } else if (bcast == binary_po_bcast_none) {
+                /* src1 has the layout of dst */
+                mov(reg_po_off, reg_out);
+                sub(reg_po_off, ptr[param1 + GET_OFF(dst_orig)]);
+                add(reg_po_rhs, reg_po_off);
+            }
+
+            for (int k = 0; k < jcp.nb_oc_blocking; k++)
+            for (int j = 0; j < ur_w; j++) {
+                Vmm vmm = vmm_out(j, k);
+                size_t off = 0;
+                if (bcast == binary_po_bcast_per_oc)
+                    off = k * oc_block_size;
+                else if (bcast == binary_po_bcast_none)
+                    off = get_output_offset(j, k);
+                auto addr = EVEX_compress_addr_safe(reg_po_rhs, off,
+                        reg_out_long_offt, bcast == binary_po_bcast_scalar);
+
+                switch (e.binary.alg) {
+                case alg_kind::binary_add: vaddps(vmm, vmm, addr); break;
+                case alg_kind::binary_mul: vmulps(vmm, vmm, addr); break;
+                case alg_kind::binary_max: vmaxps(vmm, vmm, addr); break;
+                case alg_kind::binary_min: vminps(vmm, vmm, addr); break;
+                default: assert(!"unsupported binary alg");
+                }
+            }
+        }
+    }
+}
+
 template<typename Vmm>
 void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(int ur_w)
 {
@@ -134,18 +213,12 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(int ur_w)
     }
 
     L(eltwise_label);
-    if (jcp.with_eltwise) {
+    /* the leading sum is done by accumulating into dst above */
+    if (attr_.post_ops_.len_ > (jcp.with_sum ? 1 : 0)) {
         cmp(reg_channel, jcp.nb_ic - 1);
         jl(store_label, T_NEAR);
 
-        if (ur_w == jcp.ur_w) {
-            eltwise_injector_->compute_vector_range(0,
-                    jcp.nb_oc_blocking * jcp.ur_w);
-        } else {
-            for (int k = 0; k < jcp.nb_oc_blocking; k++)
-                eltwise_injector_->compute_vector_range(k * jcp.ur_w,
-                        k * jcp.ur_w + ur_w);
-        }
+        apply_post_ops(ur_w);
     }
 
     L(store_label);
@@ -1085,25 +1158,26 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::generate()
     }
     postamble();
 
-    if (jcp.with_eltwise)
-        eltwise_injector_->prepare_table();
+    for (size_t i = 0; i < eltwise_injectors_.size(); i++)
+        if (eltwise_injectors_[i])
+            eltwise_injectors_[i]->prepare_table();
 }
 
 bool jit_avx512_common_conv_fwd_kernel::post_ops_ok(
         jit_conv_conf_t &jcp, const primitive_attr_t &attr) {
     const auto &p = attr.post_ops_;
+    if (p.find(primitive_kind::binary) != -1 && p.len_ > binary_po_max_len)
+        return false;
 
-    auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
-    auto is_sum = [&](int idx) { return p.entry_[idx].is_sum(); };
-
-    switch (p.len_) {
-    case 0: return true; // no post_ops
-    case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
-    case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
-    default: return false;
+    for (int i = 0; i < p.len_; i++) {
+        const auto &e = p.entry_[i];
+        /* sum is done by accumulating into dst, hence goes first */
+        const bool ok = (e.is_sum() && i == 0) || e.is_eltwise()
+            || e.is_scale_shift() || e.is_binary();
+        if (!ok) return false;
     }
 
-    return false;
+    return true;
 }
 
 status_t jit_avx512_common_conv_fwd_kernel::init_conf(
@@ -1237,6 +1311,22 @@ status_t jit_avx512_common_conv_fwd_kernel::init_conf(
     if (jcp.dst_tag != dst_tag)
         return status::unimplemented;
 
+    for (int i = 0; i < p.len_; i++) {
+        const auto &e = p.entry_[i];
+        bool per_oc = e.is_scale_shift() && e.scale_shift.mask != 0;
+        if (e.is_binary()) {
+            const auto &src1_md = e.binary.src1_desc;
+            if (!binary_po_src1_ok(src1_md, dst_md)
+                    || src1_md.data_type != data_type::f32)
+                return status::unimplemented;
+            per_oc = get_binary_po_bcast(src1_md, dst_d.dims()[1])
+                == binary_po_bcast_per_oc;
+        }
+        /* per-channel values are read by whole oc blocks */
+        if (per_oc && jcp.oc != jcp.oc_without_padding)
+            return status::unimplemented;
+    }
+
     jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
     if (jcp.with_bias) {
         if (bias_d.format_kind() == format_kind::any)
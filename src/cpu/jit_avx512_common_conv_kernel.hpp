@@ -33,18 +33,22 @@ struct _jit_avx512_common_conv_fwd_kernel : public jit_generator {
 
     _jit_avx512_common_conv_fwd_kernel(jit_conv_conf_t ajcp,
             const primitive_attr_t &attr)
-        : jcp(ajcp), attr_(attr), eltwise_injector_(nullptr)
+        : jcp(ajcp), attr_(attr)
     {
-        if (jcp.with_eltwise)
-            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
-                    this, jcp.eltwise);
+        const auto &p = attr_.post_ops_;
+        for (int i = 0; i < p.len_; i++)
+            eltwise_injectors_.push_back(p.entry_[i].is_eltwise()
+                    ? new jit_uni_eltwise_injector_f32<avx512_common>(
+                            this, p.entry_[i].eltwise)
+                    : nullptr);
 
         generate();
         jit_ker_ = (void (*)(jit_conv_call_s *))getCode();
     }
 
     ~_jit_avx512_common_conv_fwd_kernel() {
-        delete eltwise_injector_;
+        for (size_t i = 0; i < eltwise_injectors_.size(); i++)
+            delete eltwise_injectors_[i];
     }
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(_jit_avx512_common_conv_fwd_kernel)
@@ -107,6 +111,10 @@ private:
     reg64_t reg_long_offt = r11;
     reg64_t reg_out_long_offt = r14;
 
+    /* used in the post-ops chain only, after bias is applied */
+    reg64_t reg_po_rhs = rdx;
+    reg64_t reg_po_off = rsi;
+
     inline Vmm vmm_ker(int i_ic) {
         assert(i_ic < 4);
         return Vmm(ker_reg_base_idx + i_ic);
@@ -126,10 +134,14 @@ private:
 
     Xbyak::Reg64 imm_addr64 = r15;
     Vmm vmm_wei = Vmm(31);
+    Vmm vmm_po_scale = Vmm(31);
 
-    jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
+    /* one injector per eltwise post-op, nullptr for the other entries */
+    nstl::vector<jit_uni_eltwise_injector_f32<avx512_common> *>
+        eltwise_injectors_;
 
     inline void prepare_output(int ur_w);
+    inline void apply_post_ops(int ur_w);
     inline void store_output(int ur_w);
     inline void compute_loop_fma(int ur_w, int pad_l, int pad_r);
     inline void compute_loop_fma_core(int ur_w, int pad_l, int pad_r);
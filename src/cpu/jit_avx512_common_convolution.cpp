@@ -59,7 +59,7 @@ inline void jit_conv_ker_pipeline(jit_conv_ker_t ker, jit_conv_call_s &p,
 // TODO: implement it for BWD_D and BWD_W too
 inline void jit_conv_ker_pipeline_ow_thr(jit_conv_ker_t ker, jit_conv_call_s &p,
         const void *src, const void *dst, const void *filt, const void *bias,
-        int channel, int kh_padding, int owb)
+        int channel, int kh_padding, int owb, int oc_l_off)
 {
     PIPELINE(src);
     PIPELINE(dst);
@@ -70,6 +70,7 @@ inline void jit_conv_ker_pipeline_ow_thr(jit_conv_ker_t ker, jit_conv_call_s &p,
     // skip computation part and initialize output by zeroes
     PIPELINE(kh_padding);
     PIPELINE(owb);
+    PIPELINE(oc_l_off);
 
     if (p.src)
         ker(&p);
@@ -96,7 +97,8 @@ inline void jit_conv_3d_ker_pipeline(jit_conv_ker_t ker, jit_conv_call_s &p,
 // TODO: implement it for BWD_D and BWD_W too
 inline void jit_conv_3d_ker_pipeline_ow_thr(jit_conv_ker_t ker,
         jit_conv_call_s &p, const void *src, const void *dst, const void *filt,
-        const void *bias, int channel, int kh_padding, int kd_padding, int owb)
+        const void *bias, int channel, int kh_padding, int kd_padding, int owb,
+        int oc_l_off)
 {
     PIPELINE(src);
     PIPELINE(dst);
@@ -108,6 +110,7 @@ inline void jit_conv_3d_ker_pipeline_ow_thr(jit_conv_ker_t ker,
     PIPELINE(kh_padding);
     PIPELINE(kd_padding);
     PIPELINE(owb);
+    PIPELINE(oc_l_off);
 
     if (p.src)
         ker(&p);
@@ -180,6 +183,10 @@ execute_forward_1d(const exec_ctx_t &ctx) const {
     auto bias = CTX_IN_MEM(const dst_data_t *, MKLDNN_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, MKLDNN_ARG_DST);
 
+    const void *post_ops_binary_rhs_buf[binary_po_max_len];
+    const auto post_ops_binary_rhs
+        = binary_po_rhs(ctx, post_ops_binary_rhs_buf);
+
     prepare_padded_bias(bias, this->scratchpad(ctx));
 
     const memory_desc_wrapper src_d(pd()->src_md());
@@ -204,6 +211,8 @@ execute_forward_1d(const exec_ctx_t &ctx) const {
         start_copy = start;
 
         auto par_conv = jit_conv_call_s();
+        par_conv.dst_orig = dst;
+        par_conv.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs;
         size_t src_c_stride = src_d.blk_off(0, 1);
         size_t wht_ic_stride = wht_blk_off(weights_d, 0, 0, 1);
 
@@ -239,7 +248,7 @@ execute_forward_1d(const exec_ctx_t &ctx) const {
                 for (int icb = icb_l2;
                      icb < min(jcp.nb_ic, icb_l2 + jcp.nb_ic_L2); ++icb) {
                      jit_conv_ker_pipeline_ow_thr(kernel_->jit_ker, par_conv,
-                        src_w, dst_w, wht_w, bias_w, icb, 1, owb);
+                        src_w, dst_w, wht_w, bias_w, icb, 1, owb, g_oc);
 
                     src_w += src_c_stride;
                     wht_w += wht_ic_stride;
@@ -263,7 +272,7 @@ execute_forward_1d(const exec_ctx_t &ctx) const {
         // here as call parameters to avoid execution of prefetch instructions
         // with nullptr, other parameters are not used in real jit call here
         jit_conv_ker_pipeline_ow_thr(kernel_->jit_ker, par_conv,
-                src, dst, weights, bias, 0, 0, 0);
+                src, dst, weights, bias, 0, 0, 0, 0);
     });
 }
 
@@ -276,6 +285,10 @@ execute_forward_2d(const exec_ctx_t &ctx) const {
     auto bias = CTX_IN_MEM(const dst_data_t *, MKLDNN_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, MKLDNN_ARG_DST);
 
+    const void *post_ops_binary_rhs_buf[binary_po_max_len];
+    const auto post_ops_binary_rhs
+        = binary_po_rhs(ctx, post_ops_binary_rhs_buf);
+
     prepare_padded_bias(bias, this->scratchpad(ctx));
 
     const memory_desc_wrapper src_d(pd()->src_md());
@@ -300,6 +313,8 @@ execute_forward_2d(const exec_ctx_t &ctx) const {
         start_copy = start;
 
         auto par_conv = jit_conv_call_s();
+        par_conv.dst_orig = dst;
+        par_conv.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs;
         size_t src_h_stride = src_d.blk_off(0, 0, 1);
         size_t src_c_stride = src_d.blk_off(0, 1);
         size_t dst_h_stride = dst_d.blk_off(0, 0, 1);
@@ -362,7 +377,7 @@ execute_forward_2d(const exec_ctx_t &ctx) const {
 
                             jit_conv_ker_pipeline_ow_thr(kernel_->jit_ker,
                                 par_conv, aux_src, dst_c, aux_wht, bias_w, icb,
-                                kh_padding, owb);
+                                kh_padding, owb, g_oc);
 
                             src_c += src_h_stride * jcp.stride_h;
                             dst_c += dst_h_stride;
@@ -388,7 +403,7 @@ execute_forward_2d(const exec_ctx_t &ctx) const {
         // here as call parameters to avoid execution of prefetch instructions
         // with nullptr, other parameters are not used in real jit call here
         jit_conv_ker_pipeline_ow_thr(kernel_->jit_ker, par_conv,
-                src, dst, weights, bias, 0, 0, 0);
+                src, dst, weights, bias, 0, 0, 0, 0);
     });
 }
 
@@ -401,6 +416,10 @@ execute_forward_3d(const exec_ctx_t &ctx) const {
     auto bias = CTX_IN_MEM(const dst_data_t *, MKLDNN_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, MKLDNN_ARG_DST);
 
+    const void *post_ops_binary_rhs_buf[binary_po_max_len];
+    const auto post_ops_binary_rhs
+        = binary_po_rhs(ctx, post_ops_binary_rhs_buf);
+
     prepare_padded_bias(bias, this->scratchpad(ctx));
 
     const memory_desc_wrapper src_d(pd()->src_md());
@@ -420,6 +439,8 @@ execute_forward_3d(const exec_ctx_t &ctx) const {
         start_copy = start;
 
         auto par_conv = jit_conv_call_s();
+        par_conv.dst_orig = dst;
+        par_conv.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs;
         size_t src_d_stride = src_d.blk_off(0, 0, 1);
         size_t src_h_stride = src_d.blk_off(0, 0, 0, 1);
         size_t src_c_stride = src_d.blk_off(0, 1);
@@ -491,7 +512,7 @@ execute_forward_3d(const exec_ctx_t &ctx) const {
                             par_conv,
                             src_c + i_t_overflow * dilate_h * src_h_stride,
                             dst_c, wht_w + i_t_overflow * wht_h_stride,
-                            bias_w, icb, kh_padding, kd_padding, owb);
+                            bias_w, icb, kh_padding, kd_padding, owb, g_oc);
 
                         src_c += src_h_stride * jcp.stride_h;
                         dst_c += dst_h_stride;
@@ -517,8 +538,8 @@ execute_forward_3d(const exec_ctx_t &ctx) const {
         // on the last iteration of loop above. Only valid pointers make sense
         // here as call parameters to avoid execution of prefetch instructions
         // with nullptr, other parameters are not used in real jit call here
-        jit_conv_3d_ker_pipeline(kernel_->jit_ker, par_conv,
-                src, dst, weights, bias, 0, 0, 0);
+        jit_conv_3d_ker_pipeline_ow_thr(kernel_->jit_ker, par_conv,
+                src, dst, weights, bias, 0, 0, 0, 0, 0);
     });
 }
 
@@ -0,0 +1,824 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "c_types_map.hpp"
+#include "mkldnn_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "bfloat16.hpp"
+
+#include "jit_avx512_core_bf16_conv_kernel.hpp"
+
+#undef GET_OFF
+#define GET_OFF(field) offsetof(jit_conv_call_s, field)
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace mkldnn::impl::format_tag;
+using namespace mkldnn::impl::memory_tracking::names;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+namespace {
+
+constexpr int bf16_size = sizeof(bfloat16_t);
+constexpr int max_code_size = 200 * 1024;
+
+/* Common part of the forward and backward data descriptors */
+void init_conv_dims(jit_conv_conf_t &jcp, const convolution_desc_t &cd,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &weights_d,
+        const memory_desc_wrapper &dst_d) {
+    const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
+    const int ndims = src_d.ndims();
+
+    jcp.ndims = ndims;
+    jcp.prop_kind = cd.prop_kind;
+    jcp.ngroups = with_groups ? weights_d.dims()[0] : 1;
+    jcp.mb = src_d.dims()[0];
+    jcp.oc = dst_d.dims()[1] / jcp.ngroups;
+    jcp.oc_without_padding = jcp.oc;
+    jcp.ic = src_d.dims()[1] / jcp.ngroups;
+    jcp.ic_without_padding = jcp.ic;
+    jcp.ih = src_d.dims()[2];
+    jcp.iw = src_d.dims()[3];
+    jcp.oh = dst_d.dims()[2];
+    jcp.ow = dst_d.dims()[3];
+    jcp.kh = weights_d.dims()[with_groups + 2];
+    jcp.kw = weights_d.dims()[with_groups + 3];
+    jcp.t_pad = cd.padding[0][0];
+    jcp.l_pad = cd.padding[0][1];
+    jcp.stride_h = cd.strides[0];
+    jcp.stride_w = cd.strides[1];
+    jcp.dilate_h = cd.dilates[0];
+    jcp.dilate_w = cd.dilates[1];
+    jcp.b_pad = (jcp.oh - 1) * jcp.stride_h + (jcp.kh - 1) * (jcp.dilate_h + 1)
+            - (jcp.ih + jcp.t_pad - 1);
+    jcp.r_pad = (jcp.ow - 1) * jcp.stride_w + (jcp.kw - 1) * (jcp.dilate_w + 1)
+            - (jcp.iw + jcp.l_pad - 1);
+
+    jcp.simd_w = cpu_isa_traits<avx512_core>::vlen / sizeof(float);
+    jcp.ic_block = jcp.oc_block = jcp.simd_w;
+
+    if (jcp.ngroups == 1) {
+        jcp.oc = rnd_up(jcp.oc, jcp.oc_block);
+        jcp.ic = rnd_up(jcp.ic, jcp.ic_block);
+    }
+    jcp.nb_ic = jcp.ic / jcp.ic_block;
+    jcp.nb_oc = jcp.oc / jcp.oc_block;
+}
+
+status_t init_tag(format_tag_t &tag, memory_desc_t &md,
+        const memory_desc_wrapper &mdw, const format_tag_t tag_value) {
+    if (mdw.format_kind() == format_kind::any) {
+        CHECK(memory_desc_init_by_tag(md, tag_value));
+        tag = tag_value;
+    } else {
+        tag = mdw.matches_one_of_tag(tag_value);
+    }
+    return tag == tag_value ? status::success : status::unimplemented;
+}
+
+/* Picks the number of channel blocks computed at once and the number of
+ * output points so that the accumulators, the blocks of weights and the
+ * broadcasted input fit into the available registers, preferring the
+ * blocking with the least loads per dot product. */
+void pick_blocking(int nb, int w, int free_regs, int &nb_blocking,
+        int &ur_w) {
+    nb_blocking = 1;
+    ur_w = nstl::min(w, free_regs - 1);
+    float best = 2.f;
+    for (int b = 4; b > 0; --b) {
+        if (nb % b != 0) continue;
+        int ur = nstl::min(w, (free_regs - b) / b);
+        if (ur <= 0) continue;
+        float loads_per_dp = (float)(ur + b) / (ur * b);
+        if (loads_per_dp < best) {
+            best = loads_per_dp;
+            nb_blocking = b;
+            ur_w = ur;
+        }
+    }
+}
+
+int vmm_free_regs() { return mayiuse(avx512_core_bf16) ? 31 : 26; }
+
+}
+
+void jit_avx512_core_bf16_fwd_kernel::dot_product(const Zmm &acc,
+        const Zmm &wei, const Zmm &inp) {
+    if (bf16_emu_)
+        bf16_emu_->vdpbf16ps(acc, wei, inp);
+    else
+        vdpbf16ps(acc, wei, inp);
+}
+
+void jit_avx512_core_bf16_fwd_kernel::store_output(int ur_w) {
+    const int nb_oc_block = jcp.nb_oc_blocking;
+    const Zmm zmm_tmp = zmm_inp();
+
+    if (jcp.with_bias) {
+        for (int k = 0; k < nb_oc_block; k++) {
+            const int bias_offset = jcp.typesize_bia * k * jcp.oc_block;
+            if (jcp.bia_dt == data_type::bf16) {
+                vpmovzxwd(zmm_tmp, ptr[reg_bias + bias_offset]);
+                vpslld(zmm_tmp, zmm_tmp, 16);
+            } else {
+                vmovups(zmm_tmp, ptr[reg_bias + bias_offset]);
+            }
+            for (int j = 0; j < ur_w; j++)
+                vaddps(zmm_out(j, k), zmm_out(j, k), zmm_tmp);
+        }
+    }
+
+    if (jcp.with_sum) {
+        const auto &p = attr_.post_ops_;
+        const float sum_scale = p.entry_[p.find(primitive_kind::sum)].sum.scale;
+        const Zmm zmm_sum_scale = zmm_wei(0);
+        if (sum_scale != 1.f) {
+            mov(reg_tmp.cvt32(), float2int(sum_scale));
+            vpbroadcastd(zmm_sum_scale, reg_tmp.cvt32());
+        }
+        for (int k = 0; k < nb_oc_block; k++)
+        for (int j = 0; j < ur_w; j++) {
+            const size_t out_offset = (size_t)jcp.typesize_out
+                * ((size_t)k * jcp.oh * jcp.ow + j) * jcp.oc_block;
+            if (jcp.dst_dt == data_type::bf16) {
+                vpmovzxwd(zmm_tmp, ptr[reg_out + out_offset]);
+                vpslld(zmm_tmp, zmm_tmp, 16);
+            } else {
+                vmovups(zmm_tmp, ptr[reg_out + out_offset]);
+            }
+            if (sum_scale != 1.f)
+                vfmadd231ps(zmm_out(j, k), zmm_tmp, zmm_sum_scale);
+            else
+                vaddps(zmm_out(j, k), zmm_out(j, k), zmm_tmp);
+        }
+    }
+
+    if (jcp.with_eltwise) {
+        if (ur_w == jcp.ur_w) {
+            eltwise_injector_->compute_vector_range(0,
+                    nb_oc_block * jcp.ur_w);
+        } else {
+            for (int k = 0; k < nb_oc_block; k++)
+                eltwise_injector_->compute_vector_range(k * jcp.ur_w,
+                        k * jcp.ur_w + ur_w);
+        }
+    }
+
+    for (int k = 0; k < nb_oc_block; k++)
+    for (int j = 0; j < ur_w; j++) {
+        const Zmm zmm = zmm_out(j, k);
+        const size_t out_offset = (size_t)jcp.typesize_out
+            * ((size_t)k * jcp.oh * jcp.ow + j) * jcp.oc_block;
+        if (jcp.dst_dt == data_type::bf16) {
+            const Ymm ymm = Ymm(zmm.getIdx());
+            if (bf16_emu_)
+                bf16_emu_->vcvtneps2bf16(ymm, zmm);
+            else
+                vcvtneps2bf16(ymm, zmm);
+            vmovdqu16(ptr[reg_out + out_offset], ymm);
+        } else {
+            vmovups(ptr[reg_out + out_offset], zmm);
+        }
+    }
+}
+
+void jit_avx512_core_bf16_fwd_kernel::compute_loop(int ur_w, int ow_start) {
+    const int kw = jcp.kw;
+    const int stride_w = jcp.stride_w;
+    const int dilate_w = jcp.dilate_w + 1;
+    const int ic_block = jcp.ic_block;
+    const int oc_block = jcp.oc_block;
+    const int nb_oc_block = jcp.nb_oc_blocking;
+
+    auto input_offset = [=](int oi, int ic, int ki) {
+        return bf16_size * ((ki * dilate_w + oi * stride_w - jcp.l_pad)
+                * ic_block + ic);
+    };
+    auto kernel_offset = [=](int ii, int ic, int ki) {
+        return bf16_size * (ii * jcp.nb_ic * jcp.kh * kw * ic_block * oc_block
+                + ki * ic_block * oc_block + ic * oc_block);
+    };
+    auto iw_in_range = [=](int oi, int ki) {
+        int iw = (ow_start + oi) * stride_w - jcp.l_pad + ki * dilate_w;
+        return 0 <= iw && iw < jcp.iw;
+    };
+
+    Label icb_label, kh_label, skip_compute_label;
+
+    for (int k = 0; k < nb_oc_block; k++)
+    for (int j = 0; j < ur_w; j++)
+        vpxord(zmm_out(j, k), zmm_out(j, k), zmm_out(j, k));
+
+    cmp(reg_kh, 0);
+    jle(skip_compute_label, T_NEAR);
+
+    mov(aux_reg_inp_icb, reg_inp);
+    mov(aux_reg_ker_icb, reg_ker);
+    mov(reg_icb, jcp.nb_ic);
+    L(icb_label); {
+        mov(aux_reg_inp, aux_reg_inp_icb);
+        mov(aux_reg_ker, aux_reg_ker_icb);
+        mov(reg_kj, reg_kh);
+        L(kh_label); {
+            for (int ki = 0; ki < kw; ki++) {
+                int jj_start = 0;
+                while (jj_start < ur_w && !iw_in_range(jj_start, ki))
+                    jj_start++;
+                int jj_end = jj_start;
+                while (jj_end < ur_w && iw_in_range(jj_end, ki))
+                    jj_end++;
+                if (jj_start == jj_end) continue;
+
+                /* every dword holds a pair of adjacent input channels */
+                for (int ic = 0; ic < ic_block; ic += 2) {
+                    for (int ii = 0; ii < nb_oc_block; ii++)
+                        vmovups(zmm_wei(ii),
+                                ptr[aux_reg_ker + kernel_offset(ii, ic, ki)]);
+                    for (int jj = jj_start; jj < jj_end; jj++) {
+                        vpbroadcastd(zmm_inp(),
+                                ptr[aux_reg_inp + input_offset(jj, ic, ki)]);
+                        for (int ii = 0; ii < nb_oc_block; ii++)
+                            dot_product(zmm_out(jj, ii), zmm_wei(ii),
+                                    zmm_inp());
+                    }
+                }
+            }
+            add(aux_reg_ker, bf16_size * kw * ic_block * oc_block);
+            add(aux_reg_inp,
+                    bf16_size * (jcp.dilate_h + 1) * jcp.iw * ic_block);
+            dec(reg_kj);
+            jg(kh_label, T_NEAR);
+        }
+        add(aux_reg_inp_icb, bf16_size * jcp.ih * jcp.iw * ic_block);
+        add(aux_reg_ker_icb, bf16_size * jcp.kh * kw * ic_block * oc_block);
+        dec(reg_icb);
+        jg(icb_label, T_NEAR);
+    }
+
+    L(skip_compute_label);
+    store_output(ur_w);
+}
+
+void jit_avx512_core_bf16_fwd_kernel::generate() {
+    const int ow = jcp.ow;
+    const int ur_w = jcp.ur_w;
+    const int inp_shift = bf16_size * ur_w * jcp.stride_w * jcp.ic_block;
+    const int out_shift = jcp.typesize_out * ur_w * jcp.oc_block;
+
+    auto is_inner_block = [=](int ow_start) {
+        return ow_start + ur_w <= ow
+            && ow_start * jcp.stride_w - jcp.l_pad >= 0
+            && (ow_start + ur_w - 1) * jcp.stride_w - jcp.l_pad
+                + (jcp.kw - 1) * (jcp.dilate_w + 1) < jcp.iw;
+    };
+
+    preamble();
+
+    mov(reg_inp, ptr[param + GET_OFF(src)]);
+    mov(reg_out, ptr[param + GET_OFF(dst)]);
+    mov(reg_ker, ptr[param + GET_OFF(filt)]);
+    mov(reg_kh, ptr[param + GET_OFF(kh_padding)]);
+    if (jcp.with_bias)
+        mov(reg_bias, ptr[param + GET_OFF(bias)]);
+
+    if (bf16_emu_)
+        bf16_emu_->init_vcvtneps2bf16();
+
+    /* the blocks touching the padding are generated one by one, the inner
+     * ones are processed in a loop */
+    for (int ow_start = 0; ow_start < ow;) {
+        int n_blocks = 1;
+        if (is_inner_block(ow_start))
+            while (is_inner_block(ow_start + n_blocks * ur_w))
+                n_blocks++;
+
+        const int ur_w_cur = nstl::min(ur_w, ow - ow_start);
+        if (n_blocks > 1) {
+            Label ow_loop_label;
+            mov(reg_oi, n_blocks);
+            L(ow_loop_label); {
+                compute_loop(ur_w, ow_start);
+                add(reg_inp, inp_shift);
+                add(reg_out, out_shift);
+                dec(reg_oi);
+                jg(ow_loop_label, T_NEAR);
+            }
+        } else {
+            compute_loop(ur_w_cur, ow_start);
+            add(reg_inp, inp_shift);
+            add(reg_out, out_shift);
+        }
+        ow_start += n_blocks * ur_w;
+    }
+
+    postamble();
+
+    if (jcp.with_eltwise)
+        eltwise_injector_->prepare_table();
+}
+
+bool jit_avx512_core_bf16_fwd_kernel::post_ops_ok(
+        jit_conv_conf_t &jcp, const primitive_attr_t &attr) {
+    const auto &p = attr.post_ops_;
+
+    auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
+    auto is_sum = [&](int idx) { return p.entry_[idx].is_sum(); };
+
+    switch (p.len_) {
+    case 0: return true; // no post_ops
+    case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
+    case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
+    default: return false;
+    }
+
+    return false;
+}
+
+status_t jit_avx512_core_bf16_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
+        const convolution_desc_t &cd, memory_desc_t &src_md,
+        memory_desc_t &weights_md, memory_desc_t &dst_md,
+        memory_desc_t &bias_md, const primitive_attr_t &attr, int nthreads) {
+    if (!mayiuse(avx512_core))
+        return status::unimplemented;
+
+    const memory_desc_wrapper src_d(&src_md);
+    const memory_desc_wrapper weights_d(&weights_md);
+    const memory_desc_wrapper dst_d(&dst_md);
+    const memory_desc_wrapper bias_d(&bias_md);
+
+    if (src_d.ndims() != 4)
+        return status::unimplemented;
+    const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
+
+    jcp = zero<decltype(jcp)>();
+    init_conv_dims(jcp, cd, src_d, weights_d, dst_d);
+    jcp.nthr = nthreads;
+
+    if (jcp.ic % jcp.ic_block != 0 || jcp.oc % jcp.oc_block != 0)
+        return status::unimplemented;
+
+    if (!post_ops_ok(jcp, attr))
+        return status::unimplemented;
+
+    const auto &p = attr.post_ops_;
+    jcp.with_sum = p.find(primitive_kind::sum) != -1;
+    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    jcp.with_eltwise = eltwise_ind != -1;
+    if (jcp.with_eltwise)
+        jcp.eltwise = p.entry_[eltwise_ind].eltwise;
+
+    CHECK(init_tag(jcp.src_tag, src_md, src_d, nChw16c));
+    CHECK(init_tag(jcp.dst_tag, dst_md, dst_d, nChw16c));
+    CHECK(init_tag(jcp.wei_tag, weights_md, weights_d,
+                with_groups ? gOIhw8i16o2i : OIhw8i16o2i));
+
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
+    if (jcp.with_bias) {
+        if (bias_d.format_kind() == format_kind::any)
+            CHECK(memory_desc_init_by_tag(bias_md, x));
+    }
+
+    jcp.dst_dt = dst_d.data_type();
+    jcp.bia_dt = jcp.with_bias ? bias_d.data_type() : data_type::undef;
+    jcp.typesize_in = bf16_size;
+    jcp.typesize_out = types::data_type_size(jcp.dst_dt);
+    jcp.typesize_bia = jcp.with_bias ? types::data_type_size(jcp.bia_dt) : 0;
+
+    pick_blocking(jcp.nb_oc, jcp.ow, vmm_free_regs(), jcp.nb_oc_blocking,
+            jcp.ur_w);
+
+    /* the inner loop is unrolled over the filter width and the input
+     * channels; bound the size of up to four versions of it */
+    const int dp_len = mayiuse(avx512_core_bf16) ? 1 : 8;
+    auto code_size = [&](int ur_w) {
+        const int n_ops = jcp.kw * jcp.ic_block / 2
+            * (ur_w * jcp.nb_oc_blocking * dp_len + ur_w
+                    + jcp.nb_oc_blocking);
+        return 4 * 8 * n_ops;
+    };
+    while (jcp.ur_w > 1 && code_size(jcp.ur_w) > max_code_size)
+        jcp.ur_w--;
+    if (code_size(jcp.ur_w) > max_code_size)
+        return status::unimplemented;
+    jcp.ur_w_tail = jcp.ow % jcp.ur_w;
+
+    return status::success;
+}
+
+void jit_avx512_core_bf16_fwd_kernel::init_scratchpad(
+        memory_tracking::registrar_t &scratchpad, const jit_conv_conf_t &jcp) {
+    if (jcp.with_bias && jcp.oc != jcp.oc_without_padding)
+        scratchpad.book(key_conv_padded_bias, jcp.typesize_bia * jcp.oc);
+}
+
+void jit_avx512_core_bf16_bwd_data_kernel::dot_product(const Zmm &acc,
+        const Zmm &wei, const Zmm &inp) {
+    if (bf16_emu_)
+        bf16_emu_->vdpbf16ps(acc, wei, inp);
+    else
+        vdpbf16ps(acc, wei, inp);
+}
+
+void jit_avx512_core_bf16_bwd_data_kernel::store_output(int ur_w) {
+    for (int k = 0; k < jcp.nb_ic_blocking; k++)
+    for (int j = 0; j < ur_w; j++) {
+        const Zmm zmm = zmm_out(j, k);
+        const size_t out_offset = (size_t)jcp.typesize_out
+            * ((size_t)k * jcp.ih * jcp.iw + j) * jcp.ic_block;
+        if (jcp.dsrc_dt == data_type::bf16) {
+            const Ymm ymm = Ymm(zmm.getIdx());
+            if (bf16_emu_)
+                bf16_emu_->vcvtneps2bf16(ymm, zmm);
+            else
+                vcvtneps2bf16(ymm, zmm);
+            vmovdqu16(ptr[reg_src + out_offset], ymm);
+        } else {
+            vmovups(ptr[reg_src + out_offset], zmm);
+        }
+    }
+}
+
+void jit_avx512_core_bf16_bwd_data_kernel::compute_loop(int ur_w,
+        int iw_start) {
+    const int kw = jcp.kw;
+    const int stride_w = jcp.stride_w;
+    const int dilate_w = jcp.dilate_w + 1;
+    const int ic_block = jcp.ic_block;
+    const int oc_block = jcp.oc_block;
+    const int nb_ic_block = jcp.nb_ic_blocking;
+
+    /* diff_src point iw_start + jj gets a contribution through the filter
+     * point ki from the diff_dst point ow_rel(jj, ki), counted from the
+     * first point of the block, if there is such a point */
+    auto ow_stride = [=](int jj, int ki) {
+        return iw_start + jj + jcp.l_pad - ki * dilate_w;
+    };
+    auto ow_in_range = [=](int jj, int ki) {
+        int ows = ow_stride(jj, ki);
+        return ows >= 0 && ows % stride_w == 0 && ows / stride_w < jcp.ow;
+    };
+    auto ow_rel = [=](int jj, int ki) {
+        return (ow_stride(jj, ki) - iw_start) / stride_w;
+    };
+    auto kernel_offset = [=](int ii, int oc, int ki) {
+        return bf16_size * (ii * jcp.kh * kw * ic_block * oc_block
+                + ki * ic_block * oc_block + oc * ic_block);
+    };
+
+    Label ocb_label, kh_label, skip_compute_label;
+
+    for (int k = 0; k < nb_ic_block; k++)
+    for (int j = 0; j < ur_w; j++)
+        vpxord(zmm_out(j, k), zmm_out(j, k), zmm_out(j, k));
+
+    cmp(reg_kh, 0);
+    jle(skip_compute_label, T_NEAR);
+
+    mov(aux_reg_dst_ocb, reg_dst);
+    mov(aux_reg_ker_ocb, reg_ker);
+    mov(reg_ocb, jcp.nb_oc);
+    L(ocb_label); {
+        mov(aux_reg_dst, aux_reg_dst_ocb);
+        mov(aux_reg_ker, aux_reg_ker_ocb);
+        mov(reg_kj, reg_kh);
+        L(kh_label); {
+            for (int ki = 0; ki < kw; ki++) {
+                bool any = false;
+                for (int jj = 0; jj < ur_w; jj++)
+                    any = any || ow_in_range(jj, ki);
+                if (!any) continue;
+
+                /* every dword holds a pair of adjacent output channels */
+                for (int oc = 0; oc < oc_block; oc += 2) {
+                    for (int ii = 0; ii < nb_ic_block; ii++)
+                        vmovups(zmm_wei(ii),
+                                ptr[aux_reg_ker + kernel_offset(ii, oc, ki)]);
+                    for (int jj = 0; jj < ur_w; jj++) {
+                        if (!ow_in_range(jj, ki)) continue;
+                        const int dst_offset = bf16_size
+                            * (ow_rel(jj, ki) * oc_block + oc);
+                        vpbroadcastd(zmm_inp(), ptr[aux_reg_dst + dst_offset]);
+                        for (int ii = 0; ii < nb_ic_block; ii++)
+                            dot_product(zmm_out(jj, ii), zmm_wei(ii),
+                                    zmm_inp());
+                    }
+                }
+            }
+            /* the next filter row contributing to this diff_src row reads
+             * a preceding diff_dst row */
+            const int oh_shift = jcp.stride_h == 1 ? jcp.dilate_h + 1 : 1;
+            add(aux_reg_ker,
+                    bf16_size * jcp.stride_h * kw * ic_block * oc_block);
+            sub(aux_reg_dst, bf16_size * oh_shift * jcp.ow * oc_block);
+            dec(reg_kj);
+            jg(kh_label, T_NEAR);
+        }
+        add(aux_reg_dst_ocb, bf16_size * jcp.oh * jcp.ow * oc_block);
+        add(aux_reg_ker_ocb,
+                bf16_size * jcp.nb_ic * jcp.kh * kw * ic_block * oc_block);
+        dec(reg_ocb);
+        jg(ocb_label, T_NEAR);
+    }
+
+    L(skip_compute_label);
+    store_output(ur_w);
+}
+
+void jit_avx512_core_bf16_bwd_data_kernel::generate() {
+    const int iw = jcp.iw;
+    const int ur_w = jcp.ur_w;
+    const int dst_shift = bf16_size * (ur_w / jcp.stride_w) * jcp.oc_block;
+    const int src_shift = jcp.typesize_out * ur_w * jcp.ic_block;
+
+    auto is_inner_block = [=](int iw_start) {
+        return iw_start + ur_w <= iw
+            && iw_start + jcp.l_pad - (jcp.kw - 1) * (jcp.dilate_w + 1) >= 0
+            && (iw_start + ur_w - 1 + jcp.l_pad) / jcp.stride_w < jcp.ow;
+    };
+
+    preamble();
+
+    mov(reg_src, ptr[param + GET_OFF(src)]);
+    mov(reg_dst, ptr[param + GET_OFF(dst)]);
+    mov(reg_ker, ptr[param + GET_OFF(filt)]);
+    mov(reg_kh, ptr[param + GET_OFF(kh_padding)]);
+
+    if (bf16_emu_)
+        bf16_emu_->init_vcvtneps2bf16();
+
+    for (int iw_start = 0; iw_start < iw;) {
+        int n_blocks = 1;
+        if (is_inner_block(iw_start))
+            while (is_inner_block(iw_start + n_blocks * ur_w))
+                n_blocks++;
+
+        const int ur_w_cur = nstl::min(ur_w, iw - iw_start);
+        if (n_blocks > 1) {
+            Label iw_loop_label;
+            mov(reg_oi, n_blocks);
+            L(iw_loop_label); {
+                compute_loop(ur_w, iw_start);
+                add(reg_src, src_shift);
+                add(reg_dst, dst_shift);
+                dec(reg_oi);
+                jg(iw_loop_label, T_NEAR);
+            }
+        } else {
+            compute_loop(ur_w_cur, iw_start);
+            add(reg_src, src_shift);
+            add(reg_dst, dst_shift);
+        }
+        iw_start += n_blocks * ur_w;
+    }
+
+    postamble();
+}
+
+status_t jit_avx512_core_bf16_bwd_data_kernel::init_conf(
+        jit_conv_conf_t &jcp, const convolution_desc_t &cd,
+        const memory_desc_wrapper &diff_src_d,
+        const memory_desc_wrapper &weights_d,
+        const memory_desc_wrapper &diff_dst_d) {
+    if (!mayiuse(avx512_core))
+        return status::unimplemented;
+
+    if (diff_src_d.ndims() != 4)
+        return status::unimplemented;
+    const bool with_groups = weights_d.ndims() == diff_src_d.ndims() + 1;
+
+    jcp = zero<decltype(jcp)>();
+    init_conv_dims(jcp, cd, diff_src_d, weights_d, diff_dst_d);
+
+    /* a dilated filter row is not a multiple of the stride */
+    if ((jcp.dilate_w != 0 && jcp.stride_w != 1)
+            || (jcp.dilate_h != 0 && jcp.stride_h != 1))
+        return status::unimplemented;
+
+    if (jcp.ic % jcp.ic_block != 0 || jcp.oc % jcp.oc_block != 0)
+        return status::unimplemented;
+
+    jcp.src_tag = diff_src_d.matches_one_of_tag(nChw16c);
+    jcp.dst_tag = diff_dst_d.matches_one_of_tag(nChw16c);
+    jcp.wei_tag = weights_d.matches_one_of_tag(
+            with_groups ? gOIhw8o16i2o : OIhw8o16i2o);
+    if (jcp.src_tag != nChw16c || jcp.dst_tag != nChw16c
+            || jcp.wei_tag != (with_groups ? gOIhw8o16i2o : OIhw8o16i2o))
+        return status::unimplemented;
+
+    jcp.dsrc_dt = diff_src_d.data_type();
+    jcp.typesize_in = bf16_size;
+    jcp.typesize_out = types::data_type_size(jcp.dsrc_dt);
+
+    pick_blocking(jcp.nb_ic, jcp.iw, vmm_free_regs(), jcp.nb_ic_blocking,
+            jcp.ur_w);
+
+    /* the blocks processed in a loop have to start at the same phase of
+     * the stride */
+    jcp.ur_w = nstl::max(jcp.stride_w, jcp.ur_w / jcp.stride_w * jcp.stride_w);
+    if (jcp.ur_w * jcp.nb_ic_blocking > vmm_free_regs() - jcp.nb_ic_blocking)
+        return status::unimplemented;
+
+    const int dp_len = mayiuse(avx512_core_bf16) ? 1 : 8;
+    auto code_size = [&](int ur_w) {
+        const int n_ops = jcp.kw * jcp.oc_block / 2
+            * (ur_w * jcp.nb_ic_blocking * dp_len / jcp.stride_w + ur_w
+                    + jcp.nb_ic_blocking);
+        return 4 * 8 * n_ops;
+    };
+    while (jcp.ur_w > jcp.stride_w && code_size(jcp.ur_w) > max_code_size)
+        jcp.ur_w -= jcp.stride_w;
+    if (code_size(jcp.ur_w) > max_code_size)
+        return status::unimplemented;
+    jcp.ur_w_tail = jcp.iw % jcp.ur_w;
+
+    return status::success;
+}
+
+void jit_avx512_core_bf16_conv_bwd_weights_kernel_f32::compute_ow_step(
+        int ow) {
+    const int stride_w = jcp.stride_w;
+    const int dilate_w = jcp.dilate_w + 1;
+    const int ic_block = jcp.ic_block;
+
+    vpmovzxwd(zmm_ddst, ptr[aux_reg_ddst]);
+    vpslld(zmm_ddst, zmm_ddst, 16);
+
+    for (int ki = 0; ki < jcp.kw; ki++) {
+        const int iw = ow * stride_w - jcp.l_pad + ki * dilate_w;
+        if (iw < 0 || iw >= jcp.iw) continue;
+        for (int ic = 0; ic < jcp.ic_block_step; ic++) {
+            const int src_offset = (int)sizeof(float)
+                * ((ki * dilate_w - jcp.l_pad) * ic_block + ic);
+            vfmadd231ps(zmm_acc(ki, ic), zmm_ddst,
+                    zword_b[aux_reg_src + src_offset]);
+        }
+    }
+
+    add(aux_reg_src, sizeof(float) * stride_w * ic_block);
+    add(aux_reg_ddst, bf16_size * jcp.oc_block);
+}
+
+void jit_avx512_core_bf16_conv_bwd_weights_kernel_f32::generate() {
+    const int ow = jcp.ow;
+    const int ic_block = jcp.ic_block;
+    const int oc_block = jcp.oc_block;
+
+    auto wei_offset = [=](int ki, int ic) {
+        return (int)sizeof(float) * (ki * ic_block + ic) * oc_block;
+    };
+    auto is_inner_point = [=](int ow) {
+        return ow < jcp.ow
+            && ow * jcp.stride_w - jcp.l_pad >= 0
+            && ow * jcp.stride_w - jcp.l_pad
+                + (jcp.kw - 1) * (jcp.dilate_w + 1) < jcp.iw;
+    };
+
+    preamble();
+
+    mov(reg_src, ptr[param + GET_OFF(src)]);
+    mov(reg_ddst, ptr[param + GET_OFF(dst)]);
+    mov(reg_wei, ptr[param + GET_OFF(filt)]);
+    mov(reg_rows, ptr[param + GET_OFF(kh_padding)]);
+    mov(reg_flags.cvt32(), ptr[param + GET_OFF(flags)]);
+
+    Label load_label, rows_label, store_label;
+
+    test(reg_flags, FLAG_ZERO_FILTER);
+    jz(load_label, T_NEAR);
+    for (int ki = 0; ki < jcp.kw; ki++)
+    for (int ic = 0; ic < jcp.ic_block_step; ic++)
+        vpxord(zmm_acc(ki, ic), zmm_acc(ki, ic), zmm_acc(ki, ic));
+    jmp(rows_label, T_NEAR);
+
+    L(load_label);
+    for (int ki = 0; ki < jcp.kw; ki++)
+    for (int ic = 0; ic < jcp.ic_block_step; ic++)
+        vmovups(zmm_acc(ki, ic), ptr[reg_wei + wei_offset(ki, ic)]);
+
+    L(rows_label);
+    cmp(reg_rows, 0);
+    jle(store_label, T_NEAR);
+    {
+        Label row_label;
+        L(row_label);
+        mov(aux_reg_src, reg_src);
+        mov(aux_reg_ddst, reg_ddst);
+        for (int ow_start = 0; ow_start < ow;) {
+            int n_points = 1;
+            if (is_inner_point(ow_start))
+                while (is_inner_point(ow_start + n_points))
+                    n_points++;
+
+            if (n_points > 1) {
+                Label ow_loop_label;
+                mov(reg_oi, n_points);
+                L(ow_loop_label); {
+                    compute_ow_step(ow_start);
+                    dec(reg_oi);
+                    jg(ow_loop_label, T_NEAR);
+                }
+            } else {
+                compute_ow_step(ow_start);
+            }
+            ow_start += n_points;
+        }
+        add(reg_src, sizeof(float) * jcp.stride_h * jcp.iw * ic_block);
+        add(reg_ddst, bf16_size * jcp.ow * oc_block);
+        dec(reg_rows);
+        jg(row_label, T_NEAR);
+    }
+
+    L(store_label);
+    for (int ki = 0; ki < jcp.kw; ki++)
+    for (int ic = 0; ic < jcp.ic_block_step; ic++)
+        vmovups(ptr[reg_wei + wei_offset(ki, ic)], zmm_acc(ki, ic));
+
+    postamble();
+}
+
+status_t jit_avx512_core_bf16_conv_bwd_weights_kernel_f32::init_conf(
+        jit_conv_conf_t &jcp, const convolution_desc_t &cd,
+        memory_desc_t &src_md, memory_desc_t &diff_weights_md,
+        memory_desc_t &diff_bias_md, memory_desc_t &diff_dst_md) {
+    if (!mayiuse(avx512_core))
+        return status::unimplemented;
+
+    const memory_desc_wrapper src_d(&src_md);
+    const memory_desc_wrapper diff_weights_d(&diff_weights_md);
+    const memory_desc_wrapper diff_bias_d(&diff_bias_md);
+    const memory_desc_wrapper diff_dst_d(&diff_dst_md);
+
+    if (src_d.ndims() != 4)
+        return status::unimplemented;
+    const bool with_groups = diff_weights_d.ndims() == src_d.ndims() + 1;
+
+    jcp = zero<decltype(jcp)>();
+    init_conv_dims(jcp, cd, src_d, diff_weights_d, diff_dst_d);
+
+    if (jcp.ic % jcp.ic_block != 0 || jcp.oc % jcp.oc_block != 0)
+        return status::unimplemented;
+
+    CHECK(init_tag(jcp.src_tag, src_md, src_d, nChw16c));
+    CHECK(init_tag(jcp.dst_tag, diff_dst_md, diff_dst_d, nChw16c));
+    CHECK(init_tag(jcp.wei_tag, diff_weights_md, diff_weights_d,
+                with_groups ? gOIhw16i16o : OIhw16i16o));
+
+    jcp.with_bias = cd.diff_bias_desc.format_kind != format_kind::undef;
+    if (jcp.with_bias) {
+        if (diff_bias_d.format_kind() == format_kind::any)
+            CHECK(memory_desc_init_by_tag(diff_bias_md, x));
+    }
+
+    jcp.dwei_dt = diff_weights_d.data_type();
+    jcp.bia_dt = jcp.with_bias ? diff_bias_d.data_type() : data_type::undef;
+    jcp.typesize_in = bf16_size;
+    jcp.typesize_out = types::data_type_size(jcp.dwei_dt);
+
+    /* one accumulator per filter point and input channel of the step */
+    const int max_acc = 28;
+    jcp.ic_block_step = jcp.ic_block;
+    while (jcp.ic_block_step > 1 && jcp.kw * jcp.ic_block_step > max_acc)
+        jcp.ic_block_step /= 2;
+    if (jcp.kw * jcp.ic_block_step > max_acc)
+        return status::unimplemented;
+
+    jcp.nthr = mkldnn_get_max_threads();
+
+    return status::success;
+}
+
+void jit_avx512_core_bf16_conv_bwd_weights_kernel_f32::init_scratchpad(
+        memory_tracking::registrar_t &scratchpad, const jit_conv_conf_t &jcp) {
+    /* src of the current image converted to f32 */
+    scratchpad.book(key_conv_tr_src,
+            sizeof(float) * jcp.nthr * jcp.ih * jcp.iw * jcp.ic_block);
+    /* f32 accumulators of a block of bf16 diff_weights */
+    if (jcp.dwei_dt == data_type::bf16)
+        scratchpad.book(key_conv_wei_reduction, sizeof(float) * jcp.nthr
+                * jcp.kh * jcp.kw * jcp.ic_block * jcp.oc_block);
+}
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
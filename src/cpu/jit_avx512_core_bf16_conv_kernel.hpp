@@ -0,0 +1,257 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_AVX512_CORE_BF16_CONV_KERNEL_HPP
+#define JIT_AVX512_CORE_BF16_CONV_KERNEL_HPP
+
+#include "c_types_map.hpp"
+#include "memory_tracking.hpp"
+
+#include "jit_avx512_core_bf16cvt.hpp"
+#include "jit_generator.hpp"
+#include "jit_primitive_conf.hpp"
+#include "jit_uni_eltwise.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+/* Direct bf16 convolution kernels.
+ *
+ * The forward and backward data kernels compute one row of the output with
+ * vdpbf16ps (or its emulation on avx512_core), reducing over all the input
+ * channel blocks and the filter inside the kernel, so a bf16 destination is
+ * rounded only once. The backward weights kernel accumulates in f32 over a
+ * row range of src converted to f32 by the driver. */
+
+struct jit_avx512_core_bf16_fwd_kernel : public jit_generator {
+
+    jit_avx512_core_bf16_fwd_kernel(jit_conv_conf_t ajcp,
+            const primitive_attr_t &attr)
+        : jcp(ajcp), attr_(attr), eltwise_injector_(nullptr)
+        , bf16_emu_(nullptr)
+    {
+        if (jcp.with_eltwise)
+            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
+                    this, jcp.eltwise);
+        if (!mayiuse(avx512_core_bf16))
+            bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
+                    bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
+                    bf16_emu_reserv_4, bf16_emu_reserv_5);
+
+        generate();
+        jit_ker = (void (*)(jit_conv_call_s *))getCode();
+    }
+
+    ~jit_avx512_core_bf16_fwd_kernel() {
+        delete eltwise_injector_;
+        delete bf16_emu_;
+    }
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_bf16_fwd_kernel)
+
+    static bool post_ops_ok(jit_conv_conf_t &jcp,
+            const primitive_attr_t &attr);
+    static status_t init_conf(jit_conv_conf_t &jcp,
+            const convolution_desc_t &cd, memory_desc_t &src_md,
+            memory_desc_t &weights_md, memory_desc_t &dst_md,
+            memory_desc_t &bias_md, const primitive_attr_t &attr,
+            int nthreads);
+    static void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+            const jit_conv_conf_t &jcp);
+
+    jit_conv_conf_t jcp;
+    const primitive_attr_t &attr_;
+    void (*jit_ker)(jit_conv_call_s *);
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+
+    reg64_t param = abi_param1;
+    reg64_t reg_inp = r8;
+    reg64_t reg_ker = r9;
+    reg64_t reg_out = r10;
+    reg64_t reg_bias = r11;
+    reg64_t reg_kh = r12;
+    reg64_t reg_kj = r13;
+    reg64_t aux_reg_inp = r14;
+    reg64_t aux_reg_ker = r15;
+    reg64_t reg_icb = rbx;
+    reg64_t reg_oi = rdx;
+    reg64_t aux_reg_inp_icb = rsi;
+    reg64_t aux_reg_ker_icb = rbp;
+    reg64_t reg_tmp = rax;
+
+    /* vdpbf16ps emulation occupies the upper five registers */
+    Xbyak::Zmm bf16_emu_reserv_1 = Xbyak::Zmm(31);
+    Xbyak::Zmm bf16_emu_reserv_2 = Xbyak::Zmm(30);
+    Xbyak::Zmm bf16_emu_reserv_3 = Xbyak::Zmm(29);
+    Xbyak::Zmm bf16_emu_reserv_4 = Xbyak::Zmm(28);
+    Xbyak::Zmm bf16_emu_reserv_5 = Xbyak::Zmm(27);
+    reg64_t bf16_emu_scratch = reg_tmp;
+
+    jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
+    bf16_emulation_t *bf16_emu_;
+
+    int vmm_free_idx() const { return bf16_emu_ ? 26 : 31; }
+    Xbyak::Zmm zmm_out(int i_ur, int i_oc) {
+        int idx = i_ur + i_oc * jcp.ur_w;
+        assert(idx < vmm_free_idx() - jcp.nb_oc_blocking);
+        return Xbyak::Zmm(idx);
+    }
+    Xbyak::Zmm zmm_wei(int i_oc) {
+        return Xbyak::Zmm(vmm_free_idx() - i_oc);
+    }
+    Xbyak::Zmm zmm_inp() {
+        return Xbyak::Zmm(vmm_free_idx() - jcp.nb_oc_blocking);
+    }
+
+    void dot_product(const Xbyak::Zmm &acc, const Xbyak::Zmm &wei,
+            const Xbyak::Zmm &inp);
+    void store_output(int ur_w);
+    void compute_loop(int ur_w, int ow_start);
+
+    void generate();
+};
+
+struct jit_avx512_core_bf16_bwd_data_kernel : public jit_generator {
+
+    jit_avx512_core_bf16_bwd_data_kernel(jit_conv_conf_t ajcp)
+        : jcp(ajcp), bf16_emu_(nullptr)
+    {
+        if (!mayiuse(avx512_core_bf16))
+            bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
+                    bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
+                    bf16_emu_reserv_4, bf16_emu_reserv_5);
+
+        generate();
+        jit_ker = (void (*)(jit_conv_call_s *))getCode();
+    }
+
+    ~jit_avx512_core_bf16_bwd_data_kernel() { delete bf16_emu_; }
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_bf16_bwd_data_kernel)
+
+    static status_t init_conf(jit_conv_conf_t &jcp,
+            const convolution_desc_t &cd, const memory_desc_wrapper &diff_src_d,
+            const memory_desc_wrapper &weights_d,
+            const memory_desc_wrapper &diff_dst_d);
+
+    jit_conv_conf_t jcp;
+    void (*jit_ker)(jit_conv_call_s *);
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+
+    reg64_t param = abi_param1;
+    reg64_t reg_dst = r8;
+    reg64_t reg_ker = r9;
+    reg64_t reg_src = r10;
+    reg64_t reg_kh = r12;
+    reg64_t reg_kj = r13;
+    reg64_t aux_reg_dst = r14;
+    reg64_t aux_reg_ker = r15;
+    reg64_t reg_ocb = rbx;
+    reg64_t reg_oi = rdx;
+    reg64_t aux_reg_dst_ocb = rsi;
+    reg64_t aux_reg_ker_ocb = rbp;
+    reg64_t reg_tmp = rax;
+
+    Xbyak::Zmm bf16_emu_reserv_1 = Xbyak::Zmm(31);
+    Xbyak::Zmm bf16_emu_reserv_2 = Xbyak::Zmm(30);
+    Xbyak::Zmm bf16_emu_reserv_3 = Xbyak::Zmm(29);
+    Xbyak::Zmm bf16_emu_reserv_4 = Xbyak::Zmm(28);
+    Xbyak::Zmm bf16_emu_reserv_5 = Xbyak::Zmm(27);
+    reg64_t bf16_emu_scratch = reg_tmp;
+
+    bf16_emulation_t *bf16_emu_;
+
+    int vmm_free_idx() const { return bf16_emu_ ? 26 : 31; }
+    Xbyak::Zmm zmm_out(int i_ur, int i_ic) {
+        int idx = i_ur + i_ic * jcp.ur_w;
+        assert(idx < vmm_free_idx() - jcp.nb_ic_blocking);
+        return Xbyak::Zmm(idx);
+    }
+    Xbyak::Zmm zmm_wei(int i_ic) {
+        return Xbyak::Zmm(vmm_free_idx() - i_ic);
+    }
+    Xbyak::Zmm zmm_inp() {
+        return Xbyak::Zmm(vmm_free_idx() - jcp.nb_ic_blocking);
+    }
+
+    void dot_product(const Xbyak::Zmm &acc, const Xbyak::Zmm &wei,
+            const Xbyak::Zmm &inp);
+    void store_output(int ur_w);
+    void compute_loop(int ur_w, int iw_start);
+
+    void generate();
+};
+
+struct jit_avx512_core_bf16_conv_bwd_weights_kernel_f32
+    : public jit_generator {
+
+    jit_avx512_core_bf16_conv_bwd_weights_kernel_f32(jit_conv_conf_t ajcp)
+        : jcp(ajcp)
+    {
+        generate();
+        jit_ker = (void (*)(jit_conv_call_s *))getCode();
+    }
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(
+            jit_avx512_core_bf16_conv_bwd_weights_kernel_f32)
+
+    static status_t init_conf(jit_conv_conf_t &jcp,
+            const convolution_desc_t &cd, memory_desc_t &src_md,
+            memory_desc_t &diff_weights_md, memory_desc_t &diff_bias_md,
+            memory_desc_t &diff_dst_md);
+    static void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+            const jit_conv_conf_t &jcp);
+
+    jit_conv_conf_t jcp;
+    void (*jit_ker)(jit_conv_call_s *);
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+
+    reg64_t param = abi_param1;
+    reg64_t reg_src = r8;
+    reg64_t reg_ddst = r9;
+    reg64_t reg_wei = r10;
+    reg64_t reg_rows = r11;
+    reg64_t aux_reg_src = r12;
+    reg64_t aux_reg_ddst = r13;
+    reg64_t reg_oi = r14;
+    reg64_t reg_flags = r15;
+
+    Xbyak::Zmm zmm_acc(int i_kw, int i_ic) {
+        int idx = i_kw * jcp.ic_block_step + i_ic;
+        assert(idx < 31);
+        return Xbyak::Zmm(idx);
+    }
+    Xbyak::Zmm zmm_ddst = Xbyak::Zmm(31);
+
+    void compute_ow_step(int ow);
+
+    void generate();
+};
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,294 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "c_types_map.hpp"
+#include "bfloat16.hpp"
+#include "mkldnn_thread.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "jit_avx512_core_bf16_convolution.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace mkldnn::impl::status;
+using namespace mkldnn::impl::memory_tracking::names;
+using namespace mkldnn::impl::utils;
+
+using namespace nstl;
+
+#define wht_blk_off(d, g, ...) \
+        (pd()->with_groups() \
+         ? (d).blk_off((g), __VA_ARGS__) \
+         : (d).blk_off(__VA_ARGS__))
+
+void jit_avx512_core_bf16_convolution_fwd_t::prepare_padded_bias(
+        const char *&bias, const memory_tracking::grantor_t &scratchpad) const {
+    if (!pd()->wants_padded_bias()) return;
+
+    const auto &jcp = pd()->jcp_;
+    auto padded_bias = scratchpad.template get<char>(key_conv_padded_bias);
+    const size_t bia_size = jcp.typesize_bia * jcp.oc_without_padding;
+    utils::array_copy(padded_bias, bias, bia_size);
+    utils::array_set(padded_bias + bia_size, (char)0,
+            jcp.typesize_bia * (jcp.oc - jcp.oc_without_padding));
+    bias = padded_bias;
+}
+
+void jit_avx512_core_bf16_convolution_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, MKLDNN_ARG_SRC);
+    auto weights = CTX_IN_MEM(const wei_data_t *, MKLDNN_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, MKLDNN_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, MKLDNN_ARG_DST);
+
+    prepare_padded_bias(bias, this->scratchpad(ctx));
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+
+    const auto &jcp = pd()->jcp_;
+    assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
+
+    const int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
+    const int work_amount = jcp.mb * jcp.ngroups * oc_chunks * jcp.oh;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        int start{0}, end{0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        jit_conv_call_s par_conv = {};
+
+        int n{0}, g{0}, occ{0}, oh_s{0};
+        nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, occ, oc_chunks,
+                oh_s, jcp.oh);
+
+        for (int iwork = start; iwork < end; ++iwork) {
+            const int ocb = occ * jcp.nb_oc_blocking;
+            const int g_ocb = g * jcp.nb_oc + ocb;
+            const int dilate_h = jcp.dilate_h + 1;
+
+            const int ij = oh_s * jcp.stride_h - jcp.t_pad;
+            const int i_t_overflow = div_up(max(0, -ij), dilate_h);
+            const int i_b_overflow = div_up(max(0,
+                        ij + (jcp.kh - 1) * dilate_h - jcp.ih + 1), dilate_h);
+            const int kh_padding = nstl::max(0,
+                    jcp.kh - i_t_overflow - i_b_overflow);
+            const int ih = nstl::min(ij + i_t_overflow * dilate_h,
+                    jcp.ih - 1);
+
+            par_conv.src = &src[src_d.blk_off(n, g * jcp.nb_ic, ih, 0)];
+            par_conv.dst = &dst[jcp.typesize_out
+                * dst_d.blk_off(n, g_ocb, oh_s, 0)];
+            par_conv.filt = &weights[wht_blk_off(weights_d, g, ocb, 0,
+                    i_t_overflow, 0)];
+            if (bias)
+                par_conv.bias = &bias[jcp.typesize_bia * g_ocb
+                    * jcp.oc_block];
+            par_conv.kh_padding = kh_padding;
+
+            kernel_->jit_ker(&par_conv);
+
+            nd_iterator_step(n, jcp.mb, g, jcp.ngroups, occ, oc_chunks,
+                    oh_s, jcp.oh);
+        }
+    });
+}
+
+void jit_avx512_core_bf16_convolution_bwd_data_t::execute_backward_data(
+        const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, MKLDNN_ARG_DIFF_DST);
+    auto weights = CTX_IN_MEM(const wei_data_t *, MKLDNN_ARG_WEIGHTS);
+    auto diff_src = CTX_OUT_MEM(char *, MKLDNN_ARG_DIFF_SRC);
+
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+
+    const auto &jcp = pd()->jcp_;
+    assert(jcp.nb_ic % jcp.nb_ic_blocking == 0);
+
+    const int ic_chunks = jcp.nb_ic / jcp.nb_ic_blocking;
+    const int work_amount = jcp.mb * jcp.ngroups * ic_chunks * jcp.ih;
+
+    /* filter rows contributing to a diff_src row are kh_step apart and read
+     * diff_dst rows one after another, see the kernel */
+    const int dilate_h = jcp.dilate_h + 1;
+    const int kh_step = jcp.stride_h;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        int start{0}, end{0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        jit_conv_call_s par_conv = {};
+
+        int n{0}, g{0}, icc{0}, ih{0};
+        nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, icc, ic_chunks,
+                ih, jcp.ih);
+
+        for (int iwork = start; iwork < end; ++iwork) {
+            const int icb = icc * jcp.nb_ic_blocking;
+
+            auto oh_stride = [&](int kh) {
+                return ih + jcp.t_pad - kh * dilate_h;
+            };
+            int k_lo = 0;
+            while (k_lo < jcp.kh && (oh_stride(k_lo) % jcp.stride_h != 0
+                        || oh_stride(k_lo) / jcp.stride_h >= jcp.oh))
+                k_lo++;
+            int kh_padding = 0;
+            for (int kh = k_lo; kh < jcp.kh && oh_stride(kh) >= 0;
+                    kh += kh_step)
+                kh_padding++;
+            const int oh = kh_padding > 0 ? oh_stride(k_lo) / jcp.stride_h : 0;
+
+            par_conv.src = &diff_src[jcp.typesize_out
+                * diff_src_d.blk_off(n, g * jcp.nb_ic + icb, ih, 0)];
+            par_conv.dst = &diff_dst[diff_dst_d.blk_off(n, g * jcp.nb_oc, oh,
+                    0)];
+            par_conv.filt = &weights[wht_blk_off(weights_d, g, 0, icb,
+                    kh_padding > 0 ? k_lo : 0, 0)];
+            par_conv.kh_padding = kh_padding;
+
+            kernel_->jit_ker(&par_conv);
+
+            nd_iterator_step(n, jcp.mb, g, jcp.ngroups, icc, ic_chunks,
+                    ih, jcp.ih);
+        }
+    });
+}
+
+void jit_avx512_core_bf16_convolution_bwd_weights_t::compute_diff_bias(
+        const diff_dst_data_t *diff_dst, char *diff_bias, int g,
+        int ocb) const {
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const auto &jcp = pd()->jcp_;
+
+    float db[16] = {0};
+    const int oc_block = jcp.oc_block;
+    const size_t os = (size_t)jcp.oh * jcp.ow;
+
+    for (int n = 0; n < jcp.mb; ++n) {
+        const diff_dst_data_t *d = &diff_dst[diff_dst_d.blk_off(n,
+                g * jcp.nb_oc + ocb)];
+        for (size_t s = 0; s < os; ++s)
+        for (int oc = 0; oc < oc_block; ++oc)
+            db[oc] += (float)d[s * oc_block + oc];
+    }
+
+    const int oc_off = g * jcp.oc_without_padding + ocb * oc_block;
+    const int oc_len = nstl::min(oc_block,
+            jcp.oc_without_padding - ocb * oc_block);
+    if (jcp.bia_dt == data_type::bf16)
+        cvt_float_to_bfloat16((bfloat16_t *)diff_bias + oc_off, db, oc_len);
+    else
+        utils::array_copy((float *)diff_bias + oc_off, db, oc_len);
+}
+
+void jit_avx512_core_bf16_convolution_bwd_weights_t::execute_backward_weights(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, MKLDNN_ARG_SRC);
+    auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, MKLDNN_ARG_DIFF_DST);
+    auto diff_weights = CTX_OUT_MEM(char *, MKLDNN_ARG_DIFF_WEIGHTS);
+    auto diff_bias = CTX_OUT_MEM(char *, MKLDNN_ARG_DIFF_BIAS);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper diff_weights_d(pd()->diff_weights_md(0));
+
+    const auto &jcp = pd()->jcp_;
+    const auto scratchpad = this->scratchpad(ctx);
+
+    auto tr_src = scratchpad.template get<float>(key_conv_tr_src);
+    auto wei_reduction = scratchpad.template get<float>(
+            key_conv_wei_reduction);
+
+    const bool is_bf16_wei = jcp.dwei_dt == data_type::bf16;
+    const size_t src_size = (size_t)jcp.ih * jcp.iw * jcp.ic_block;
+    const size_t wei_size = (size_t)jcp.kh * jcp.kw * jcp.ic_block
+        * jcp.oc_block;
+    const int dilate_h = jcp.dilate_h + 1;
+    const int work_amount = jcp.ngroups * jcp.nb_oc * jcp.nb_ic;
+
+    /* the work is split over the blocks of diff_weights, so every thread
+     * reduces over the whole minibatch and no reduction between the threads
+     * is needed */
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        int start{0}, end{0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        jit_conv_call_s par_conv = {};
+        float *tr_src_thr = &tr_src[ithr * src_size];
+
+        int g{0}, ocb{0}, icb{0};
+        nd_iterator_init(start, g, jcp.ngroups, ocb, jcp.nb_oc, icb,
+                jcp.nb_ic);
+
+        for (int iwork = start; iwork < end; ++iwork) {
+            const size_t wei_off = wht_blk_off(diff_weights_d, g, ocb, icb);
+            float *acc = is_bf16_wei
+                ? &wei_reduction[ithr * wei_size]
+                : (float *)diff_weights + wei_off;
+
+            for (int n = 0; n < jcp.mb; ++n) {
+                cvt_bfloat16_to_float(tr_src_thr,
+                        &src[src_d.blk_off(n, g * jcp.nb_ic + icb)],
+                        src_size);
+
+                for (int kh = 0; kh < jcp.kh; ++kh) {
+                    const int oh_s = nstl::max(0,
+                            div_up(jcp.t_pad - kh * dilate_h, jcp.stride_h));
+                    const int oh_e = nstl::min(jcp.oh, div_up(jcp.ih
+                                + jcp.t_pad - kh * dilate_h, jcp.stride_h));
+                    const int ih_s = oh_s * jcp.stride_h - jcp.t_pad
+                        + kh * dilate_h;
+
+                    for (int ic = 0; ic < jcp.ic_block;
+                            ic += jcp.ic_block_step) {
+                        par_conv.src = &tr_src_thr[(size_t)ih_s * jcp.iw
+                            * jcp.ic_block + ic];
+                        par_conv.dst = &diff_dst[diff_dst_d.blk_off(n,
+                                g * jcp.nb_oc + ocb, oh_s)];
+                        par_conv.filt = &acc[(kh * jcp.kw * jcp.ic_block
+                                + ic) * jcp.oc_block];
+                        par_conv.kh_padding = nstl::max(0, oh_e - oh_s);
+                        par_conv.flags = n == 0 ? FLAG_ZERO_FILTER : 0;
+
+                        kernel_->jit_ker(&par_conv);
+                    }
+                }
+            }
+
+            if (is_bf16_wei)
+                cvt_float_to_bfloat16((bfloat16_t *)diff_weights + wei_off,
+                        acc, wei_size);
+
+            if (jcp.with_bias && icb == 0)
+                compute_diff_bias(diff_dst, diff_bias, g, ocb);
+
+            nd_iterator_step(g, jcp.ngroups, ocb, jcp.nb_oc, icb, jcp.nb_ic);
+        }
+    });
+}
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
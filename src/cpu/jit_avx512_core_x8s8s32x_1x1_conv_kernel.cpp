@@ -192,7 +192,8 @@ void jit_avx512_core_x8s8s32x_1x1_conv_kernel::reduce_loop(int load_loop_blk,
 
     auto store = [=](const bool mask_flag_in) {
         const auto &p = attr_.post_ops_;
-        const int sum_idx = p.find(primitive_kind::sum);
+        const int sum_idx = p.find(primitive_kind::sum, 0,
+                p.find(primitive_kind::convolution));
         const float *p_sum_scale = (sum_idx != -1)
             ? &p.entry_[sum_idx].sum.scale
             : nullptr;
@@ -526,6 +527,23 @@ bool jit_avx512_core_x8s8s32x_1x1_conv_kernel::post_ops_ok(
 
     auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
 
+    /* scale_shift and binary entries are not applied by this kernel, neither
+     * before nor after a fused depthwise convolution */
+    for (int idx = 0; idx < p.len_; idx++)
+        if (p.entry_[idx].is_scale_shift() || p.entry_[idx].is_binary())
+            return false;
+
+    /* the post-ops following a fused depthwise convolution are checked by
+     * its own kernel, and there is nothing to sum with before it */
+    const int dw_conv_ind = p.find(convolution);
+    if (dw_conv_ind != -1) {
+        switch (dw_conv_ind) {
+        case 0: return true; // dw_conv
+        case 1: return is_eltwise(0); // eltwise -> dw_conv
+        default: return false;
+        }
+    }
+
     switch (p.len_) {
     case 0: return true;
     case 1: return is_eltwise(0) || p.contain(sum, 0);
@@ -582,11 +600,24 @@ status_t jit_avx512_core_x8s8s32x_1x1_conv_kernel::init_conf(
         return status::unimplemented;
 
     const auto &p = attr.post_ops_;
-    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    const int dw_conv_ind = p.find(primitive_kind::convolution);
+    jcp.with_dw_conv = dw_conv_ind != -1;
+    const int eltwise_ind = p.find(primitive_kind::eltwise, 0, dw_conv_ind);
     jcp.with_eltwise = eltwise_ind != -1;
     if (jcp.with_eltwise)
         jcp.eltwise = p.entry_[eltwise_ind].eltwise;
 
+    if (jcp.with_dw_conv) {
+        /* the depthwise convolution reads its u8 input in whole blocks of
+         * channels */
+        bool dw_conv_ok = true
+            && jcp.ngroups == 1
+            && !reduce_src
+            && dst_d.data_type() == data_type::u8
+            && jcp.oc_without_padding % 16 == 0;
+        if (!dw_conv_ok) return status::unimplemented;
+    }
+
     format_tag_t dat_tag = format_tag::nhwc;
     jcp.src_tag = src_d.matches_one_of_tag(dat_tag);
     jcp.dst_tag = dst_d.matches_one_of_tag(dat_tag);
@@ -770,7 +801,9 @@ status_t jit_avx512_core_x8s8s32x_1x1_conv_kernel::init_conf(
     assert(jcp.bcast_block % jcp.ur == 0);
     assert(jcp.reduce_dim % jcp.reduce_block == 0);
 
-    jcp.ur_tail = jcp.bcast_dim % jcp.ur;
+    /* with a fused depthwise convolution the output rows go to a buffer,
+     * so the kernel is called for one row at a time unless it has no tail */
+    jcp.ur_tail = (jcp.with_dw_conv ? jcp.ow : jcp.bcast_dim) % jcp.ur;
 
     jcp.nb_bcast_blocking = bcast_blocking / jcp.bcast_block;
     jcp.nb_bcast_blocking_max = bcast_blocking_max / jcp.bcast_block;
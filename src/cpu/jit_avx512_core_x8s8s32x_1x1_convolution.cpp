@@ -39,7 +39,6 @@ execute_forward(const exec_ctx_t &ctx) const
     auto src = CTX_IN_MEM(const src_data_t *, MKLDNN_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, MKLDNN_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const char *, MKLDNN_ARG_BIAS);
-    auto dst = CTX_OUT_MEM(dst_data_t *, MKLDNN_ARG_DST);
 
     auto scratchpad = this->scratchpad(ctx);
 
@@ -57,6 +56,22 @@ execute_forward(const exec_ctx_t &ctx) const
         }
     }
 
+    if (pd()->jcp_.with_dw_conv) {
+        auto weights_dw = CTX_IN_MEM(const wei_data_t *,
+                MKLDNN_ARG_ATTR_POST_OP_DW | MKLDNN_ARG_WEIGHTS);
+        auto bias_dw = CTX_IN_MEM(const char *,
+                MKLDNN_ARG_ATTR_POST_OP_DW | MKLDNN_ARG_BIAS);
+        auto dst = CTX_OUT_MEM(char *, MKLDNN_ARG_DST);
+
+        parallel(kernel_->jcp.nthr, [&](const int ithr, const int nthr) {
+            execute_forward_fusion_thr(ithr, nthr, src, weights, bias,
+                    weights_dw, bias_dw, dst, scratchpad);
+        });
+        return;
+    }
+
+    auto dst = CTX_OUT_MEM(dst_data_t *, MKLDNN_ARG_DST);
+
     parallel(kernel_->jcp.nthr, [&](const int ithr, const int nthr) {
         execute_forward_thr(ithr, nthr, src, weights, bias, dst, scratchpad);
     });
@@ -258,6 +273,141 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type, dst_type>
 }
 
 using namespace data_type;
+/* The 1x1 convolution computes a few rows of its output into a per-thread
+ * buffer, and the fused depthwise convolution immediately turns them into
+ * rows of the final output. */
+template <data_type_t src_type, data_type_t dst_type>
+void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type, dst_type>
+::execute_forward_fusion_thr(const int ithr, const int nthr,
+        const src_data_t *src, const wei_data_t *weights, const char *bias,
+        const wei_data_t *weights_dw, const char *bias_dw, char *dst,
+        const memory_tracking::grantor_t &scratchpad) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const memory_desc_wrapper weights_dw_d(pd()->weights_md(2));
+
+    const size_t bia_dt_size = pd()->with_bias()
+        ? types::data_type_size(pd()->desc()->bias_desc.data_type) : 0;
+    const size_t bia_dw_dt_size = bias_dw
+        ? types::data_type_size(pd()->weights_md(3)->data_type) : 0;
+    const size_t dst_dt_size = types::data_type_size(dst_d.data_type());
+
+    const auto &jcp = kernel_->jcp;
+    const auto &jcp_dw = pd()->jcp_dw_;
+
+    const float *oscales = (jcp.signed_input && jcp.ver != ver_vnni)
+        ? scratchpad.get<float>(key_conv_adjusted_scales)
+        : pd()->attr()->output_scales_.scales_;
+    const float *oscales_dw
+        = pd()->dw_conv_pd_->attr()->output_scales_.scales_;
+
+    int offset = jcp.ngroups * (jcp.oc / jcp.oc_block) * (jcp.ic / jcp.ic_block)
+        * jcp.oc_block * jcp.ic_block;
+    wei_data_t *w = const_cast<wei_data_t *>(weights);
+    int32_t* compensation = (jcp.signed_input)
+        ? reinterpret_cast<int32_t *>(w + offset) : 0;
+
+    const int buffer_oh = jcp.dw_conv_buffer_oh;
+    const int dw_rows = buffer_oh - 2;
+    const int nb_oh = div_up(jcp.oh, dw_rows);
+    const size_t buffer_row_size = (size_t)jcp.ow * jcp.oc_without_padding;
+    dst_data_t *thr_buffer = scratchpad.get<dst_data_t>(
+            key_fusion_inout_buffer) + ithr * buffer_oh * buffer_row_size;
+
+    auto p = jit_1x1_conv_call_s();
+
+    auto conv_1x1 = [&](int n, int ih, int nrows, dst_data_t *out) {
+        p.bcast_dim = nrows * jcp.ow;
+        p.reduce_dim = jcp.ic;
+        p.bcast_data = src + src_d.blk_off(n, 0, ih, 0);
+
+        for (int ocb = 0; ocb < jcp.nb_load; ocb += jcp.nb_load_blocking) {
+            const int load_step
+                = nstl::min(jcp.nb_load_blocking, jcp.nb_load - ocb);
+            p.load_dim = this_block_size(ocb * jcp.oc_block, jcp.oc,
+                    load_step * jcp.oc_block);
+            p.first_last_flag
+                = ocb + load_step >= jcp.nb_load ? FLAG_OC_LAST : 0;
+
+            p.output_data = out + ocb * jcp.oc_block;
+            p.load_data = &weights[weights_d.blk_off(ocb, 0)];
+            p.bias_data = &bias[ocb * jcp.oc_block * bia_dt_size];
+            p.compensation = (jcp.signed_input)
+                ? &compensation[ocb * jcp.oc_block] : 0;
+            p.scales = &oscales[jcp.is_oc_scale * ocb * jcp.oc_block];
+
+            kernel_->jit_ker(&p);
+        }
+    };
+
+    const int nb_groups = jcp_dw.nb_ch / jcp_dw.nb_ch_blocking;
+    const size_t wht_h_stride = weights_dw_d.blk_off(0, 0, 0, 1);
+
+    auto conv_dw = [&](int n, int oh, const dst_data_t *src_row) {
+        /* the input of the depthwise convolution has jcp_dw.ih rows */
+        const int ih = oh * jcp_dw.stride_h - jcp_dw.t_pad;
+        const int i_t_overflow = nstl::min(jcp_dw.kh, nstl::max(0, -ih));
+        const int i_b_overflow = nstl::min(jcp_dw.kh,
+                nstl::max(0, ih - jcp_dw.ih + jcp_dw.kh));
+        const int kh_padding
+            = nstl::max(0, jcp_dw.kh - i_t_overflow - i_b_overflow);
+
+        for (int owb = 0; owb < jcp_dw.nb_ow; ++owb)
+        for (int gg = 0; gg < nb_groups; ++gg) {
+            auto p_dw = jit_conv_call_s();
+
+            const int gb = gg * jcp_dw.nb_ch_blocking;
+            const int g = gb * jcp_dw.ch_block;
+            const int ow_s = owb * jcp_dw.ow_block;
+            const int iw_s = ow_s * jcp_dw.stride_w;
+
+            p_dw.src = src_row + iw_s * jcp.oc_without_padding + g;
+            p_dw.dst = dst + dst_d.blk_off(n, g, oh, ow_s) * dst_dt_size;
+            p_dw.filt = weights_dw + weights_dw_d.blk_off(gb, 0)
+                + i_t_overflow * wht_h_stride;
+            p_dw.bias = bias_dw ? bias_dw + g * bia_dw_dt_size : 0;
+            p_dw.compensation = 0;
+            p_dw.oc_blocks = gb;
+            p_dw.kh_padding = kh_padding;
+            p_dw.scales = &oscales_dw[jcp_dw.is_oc_scale * g];
+            p_dw.t_overflow = i_t_overflow;
+            p_dw.b_overflow = i_b_overflow;
+            p_dw.owb = owb;
+
+            kernel_dw_->jit_ker(&p_dw);
+        }
+    };
+
+    int start{0}, end{0};
+    balance211(jcp.mb * nb_oh, nthr, ithr, start, end);
+
+    int n{0}, ohb{0};
+    nd_iterator_init(start, n, jcp.mb, ohb, nb_oh);
+    for (int iwork = start; iwork < end; ++iwork) {
+        const int oh_s = ohb * dw_rows;
+        const int oh_e = nstl::min(oh_s + dw_rows, jcp.oh);
+
+        /* buffer row r holds row oh_s - 1 + r of the 1x1 output */
+        auto buffer_row = [&](int ih) {
+            return thr_buffer + (ih - oh_s + 1) * buffer_row_size;
+        };
+
+        const int ih_s = nstl::max(oh_s - 1, 0);
+        const int ih_e = nstl::min(oh_e + 1, jcp.oh);
+        if (jcp.ur_tail == 0)
+            conv_1x1(n, ih_s, ih_e - ih_s, buffer_row(ih_s));
+        else
+            for (int ih = ih_s; ih < ih_e; ++ih)
+                conv_1x1(n, ih, 1, buffer_row(ih));
+
+        for (int oh = oh_s; oh < oh_e; ++oh)
+            conv_dw(n, oh, buffer_row(nstl::max(oh - jcp_dw.t_pad, 0)));
+
+        nd_iterator_step(n, jcp.mb, ohb, nb_oh);
+    }
+}
+
 template struct jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<u8, u8>;
 template struct jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<s8, u8>;
 template struct jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<u8, s8>;
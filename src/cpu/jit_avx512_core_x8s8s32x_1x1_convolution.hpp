@@ -26,6 +26,7 @@
 #include "cpu_primitive.hpp"
 
 #include "jit_avx512_core_x8s8s32x_1x1_conv_kernel.hpp"
+#include "jit_avx512_core_x8s8s32x_convolution.hpp"
 #include "jit_uni_1x1_conv_utils.hpp"
 
 namespace mkldnn {
@@ -39,7 +40,16 @@ struct jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t : public cpu_primitive_t {
                 const primitive_attr_t *attr,
                 const typename pd_t::base_class *hint_fwd_pd)
             : cpu_convolution_fwd_pd_t(engine, adesc, attr, hint_fwd_pd)
-            , jcp_(), rtus_() {}
+            , jcp_(), rtus_(), jcp_dw_(), dw_conv_pd_(nullptr) {}
+
+        pd_t(const pd_t &other)
+            : cpu_convolution_fwd_pd_t(other)
+            , jcp_(other.jcp_), rtus_(other.rtus_), jcp_dw_(other.jcp_dw_)
+            , dw_conv_pd_(other.dw_conv_pd_
+                    ? other.dw_conv_pd_->clone() : nullptr)
+        {}
+
+        ~pd_t() { delete dw_conv_pd_; }
 
         DECLARE_COMMON_PD_T(
                 JIT_IMPL_NAME_HELPER("jit_int8_1x1:", avx512_core, ""),
@@ -61,30 +71,153 @@ struct jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t : public cpu_primitive_t {
                 && set_or_check_wei_format();
             if (!ok) return status::unimplemented;
 
+            /* dst_md() is the output of the fused depthwise convolution, if
+             * any, so the 1x1 one is set up with dst_md_ */
             const convolution_desc_t *conv_d = desc();
             const memory_desc_t *src_d = src_md();
-            rtus_prepare(this, conv_d, src_d, dst_md());
+            rtus_prepare(this, conv_d, src_d, &dst_md_);
 
             status_t status = jit_avx512_core_x8s8s32x_1x1_conv_kernel::
-                init_conf(jcp_, *conv_d, *src_d, *weights_md(), *dst_md(),
+                init_conf(jcp_, *conv_d, *src_d, *weights_md(), dst_md_,
                         with_bias() ? *weights_md(1) : types::zero_md(),
                         *attr(), mkldnn_get_max_threads(),
                         rtus_.reduce_src_);
             if (status != status::success) return status;
 
+            if (jcp_.with_dw_conv) CHECK(depthwise_po_init());
+
             auto scratchpad = scratchpad_registry().registrar();
             jit_avx512_core_x8s8s32x_1x1_conv_kernel::init_scratchpad(
                     scratchpad, jcp_, *attr());
 
+            if (jcp_.with_dw_conv) {
+                using namespace memory_tracking::names;
+                const size_t buffer_size = (size_t)jcp_.nthr
+                    * jcp_.dw_conv_buffer_oh * jcp_.ow
+                    * jcp_.oc_without_padding;
+                scratchpad.book(key_fusion_inout_buffer,
+                        sizeof(dst_data_t) * buffer_size);
+            }
+
             rtus_prepare_space_info(this, scratchpad);
 
             return status::success;
         }
 
+        virtual arg_usage_t arg_usage(int arg) const override {
+            if (jcp_.with_dw_conv) {
+                if (arg == (MKLDNN_ARG_ATTR_POST_OP_DW | MKLDNN_ARG_WEIGHTS))
+                    return arg_usage_t::input;
+
+                if (arg == (MKLDNN_ARG_ATTR_POST_OP_DW | MKLDNN_ARG_BIAS)
+                        && dw_conv_pd_->weights_md(1) != nullptr)
+                    return arg_usage_t::input;
+            }
+
+            return cpu_convolution_fwd_pd_t::arg_usage(arg);
+        }
+
+        virtual const memory_desc_t *dst_md(int index = 0) const override {
+            if (index == 0 && jcp_.with_dw_conv)
+                return dw_conv_pd_->dst_md(0);
+            return cpu_convolution_fwd_pd_t::dst_md(index);
+        }
+
+        virtual const memory_desc_t *weights_md(int index = 0) const
+            override {
+            if (index >= 2 && jcp_.with_dw_conv)
+                return dw_conv_pd_->weights_md(index - 2);
+            return cpu_convolution_fwd_pd_t::weights_md(index);
+        }
+
+        virtual int n_inputs() const override {
+            return cpu_convolution_fwd_pd_t::n_inputs() + (jcp_.with_dw_conv
+                    ? dw_conv_pd_->n_inputs() - 1 : 0);
+        }
+
+        typedef typename prec_traits<dst_type>::type dst_data_t;
+
         jit_1x1_conv_conf_t jcp_;
         reduce_to_unit_stride_t rtus_;
+        jit_conv_conf_t jcp_dw_;
+        primitive_desc_t *dw_conv_pd_;
 
     protected:
+        template <data_type_t dw_dst_type>
+        status_t create_dw_conv_pd(const convolution_desc_t &cd,
+                const primitive_attr_t &dw_attr) {
+            using dw_conv_pd_t = typename
+                jit_avx512_core_x8s8s32x_convolution_fwd_t<data_type::u8,
+                dw_dst_type>::pd_t;
+            CHECK(mkldnn_primitive_desc::create<dw_conv_pd_t>(&dw_conv_pd_,
+                        (op_desc_t *)&cd, &dw_attr, engine_, nullptr));
+            jcp_dw_ = static_cast<dw_conv_pd_t *>(dw_conv_pd_)->jcp_;
+            return status::success;
+        }
+
+        status_t depthwise_po_init() {
+            using namespace data_type;
+            using namespace format_tag;
+
+            const auto &p = attr()->post_ops_;
+            const int dw_ind = p.find(primitive_kind::convolution);
+            const auto &dw = p.entry_[dw_ind].depthwise_conv;
+            if (dw.wei_dt != s8) return status::unimplemented;
+
+            const dim_t oc = dst_md_.dims[1];
+            const dims_t wei_dims = {oc, 1, 1, 3, 3};
+            const dims_t bias_dims = {oc};
+            memory_desc_t wei_md, bias_md, dw_dst_md = dst_md_;
+            dw_dst_md.data_type = dw.dst_dt;
+            CHECK(mkldnn_memory_desc_init_by_tag(&wei_md, 5, wei_dims,
+                        dw.wei_dt, format_tag::any));
+            if (dw.bias_dt != data_type::undef)
+                CHECK(mkldnn_memory_desc_init_by_tag(&bias_md, 1, bias_dims,
+                            dw.bias_dt, x));
+
+            const dims_t strides = {1, 1}, dilates = {0, 0};
+            const dims_t padding = {1, 1};
+            convolution_desc_t cd;
+            CHECK(conv_desc_init(&cd, desc()->prop_kind,
+                        alg_kind::convolution_direct, &dst_md_, &wei_md,
+                        dw.bias_dt != data_type::undef ? &bias_md : nullptr,
+                        &dw_dst_md, strides, dilates, padding, padding));
+            cd.accum_data_type = s32;
+
+            /* the post-ops after the depthwise entry and its scales belong
+             * to it */
+            primitive_attr_t dw_attr;
+            for (int i = dw_ind + 1; i < p.len_; ++i) {
+                dw_attr.post_ops_.entry_.push_back(p.entry_[i]);
+                dw_attr.post_ops_.len_++;
+            }
+            CHECK(dw_attr.output_scales_.set(dw.count, dw.mask, dw.scales));
+
+            switch (dw.dst_dt) {
+            case u8: CHECK(create_dw_conv_pd<u8>(cd, dw_attr)); break;
+            case s8: CHECK(create_dw_conv_pd<s8>(cd, dw_attr)); break;
+            case s32: CHECK(create_dw_conv_pd<s32>(cd, dw_attr)); break;
+            case f32: CHECK(create_dw_conv_pd<f32>(cd, dw_attr)); break;
+            default: return status::unimplemented;
+            }
+            if (!jcp_dw_.is_depthwise) return status::unimplemented;
+
+            /* a work item computes dw_rows output rows of all the channels;
+             * its 1x1 input, two rows more, should take about half of L2 */
+            const int L2_rows = (int)(get_cache_size(2, true)
+                    / 2 / sizeof(dst_data_t)
+                    / (jcp_.ow * jcp_.oc_without_padding));
+            int dw_rows = nstl::max(1, nstl::min(L2_rows - 2, jcp_.oh));
+            jcp_.nthr = mkldnn_get_max_threads();
+            while (dw_rows > 1
+                    && jcp_.mb * utils::div_up(jcp_.oh, dw_rows) < jcp_.nthr)
+                dw_rows = utils::div_up(dw_rows, 2);
+
+            jcp_.dw_conv_buffer_oh = dw_rows + 2;
+
+            return status::success;
+        }
+
         format_tag_t dat_tag() const { return format_tag::nhwc; }
 
         bool set_or_check_wei_format() {
@@ -119,15 +252,19 @@ struct jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t : public cpu_primitive_t {
 
     jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t(const pd_t *apd)
         : cpu_primitive_t(apd)
-        , kernel_(nullptr), rtus_driver_(nullptr)
+        , kernel_(nullptr), kernel_dw_(nullptr), rtus_driver_(nullptr)
     {
         kernel_ = new jit_avx512_core_x8s8s32x_1x1_conv_kernel(pd()->jcp_,
                     *pd()->attr());
+        if (pd()->jcp_.with_dw_conv)
+            kernel_dw_ = new jit_avx512_core_x8s8s32x_fwd_kernel(
+                    pd()->jcp_dw_, *pd()->dw_conv_pd_->attr());
         init_rtus_driver<avx512_common>(this);
     }
 
     ~jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t() {
         delete kernel_;
+        delete kernel_dw_;
         delete rtus_driver_;
     }
 
@@ -147,9 +284,15 @@ struct jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t : public cpu_primitive_t {
             const src_data_t *src, const wei_data_t *weights,
             const char *bias, dst_data_t *dst,
             const memory_tracking::grantor_t &scratchpad) const;
+    void execute_forward_fusion_thr(const int ithr, const int nthr,
+            const src_data_t *src, const wei_data_t *weights,
+            const char *bias, const wei_data_t *weights_dw,
+            const char *bias_dw, char *dst,
+            const memory_tracking::grantor_t &scratchpad) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd(); }
 
     jit_avx512_core_x8s8s32x_1x1_conv_kernel *kernel_;
+    jit_avx512_core_x8s8s32x_fwd_kernel *kernel_dw_;
     rtus_driver_t<avx512_common> *rtus_driver_;
 };
 
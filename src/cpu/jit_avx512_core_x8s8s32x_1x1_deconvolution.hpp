@@ -86,7 +86,8 @@ struct jit_avx512_core_x8s8s32x_1x1_deconvolution_fwd_t
                 && IMPLICATION(with_bias(), utils::one_of(
                             desc()->bias_desc.data_type, data_type::f32,
                             data_type::s32, data_type::s8, data_type::u8))
-                && desc()->accum_data_type == data_type::s32;
+                && desc()->accum_data_type == data_type::s32
+                && attr()->post_ops_.find(primitive_kind::convolution) == -1;
             if (!ok) return status::unimplemented;
 
             CHECK(init_convolution());
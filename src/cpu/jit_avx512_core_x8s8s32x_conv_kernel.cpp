@@ -46,23 +46,6 @@ void pick_loop_order(jit_conv_conf_t &jcp, int nthr)
 }
 }
 
-template<typename Vmm>
-bool _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::maybe_eltwise(int position)
-{
-    using namespace primitive_kind;
-    const auto &p = attr_.post_ops_;
-
-    if (position == 0) {
-        /* eltwise before sum */
-        return p.contain(eltwise, 0);
-    } else if (position == 1) {
-        /* eltwise after sum */
-        return p.contain(sum, 0) && p.contain(eltwise, 1);
-    }
-
-    return false;
-}
-
 template<typename Vmm>
 void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::prepare_output(int ur_w)
 {
@@ -118,17 +101,140 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::cvt2ps(data_type_t type_in,
 }
 
 template<typename Vmm>
-void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::compute_eltwise(int ur_w) {
+void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::compute_eltwise(int ur_w,
+        int po_idx) {
     int nb_oc_block
             = jcp.is_depthwise ? jcp.nb_ch_blocking : jcp.nb_oc_blocking;
+    auto *eltwise_injector = eltwise_injectors_[po_idx];
     if (ur_w == jcp.ur_w)
-        eltwise_injector_->compute_vector_range(0, nb_oc_block * jcp.ur_w);
+        eltwise_injector->compute_vector_range(0, nb_oc_block * jcp.ur_w);
     else
         for (int k = 0; k < nb_oc_block; k++)
-            eltwise_injector_->compute_vector_range(k * jcp.ur_w,
+            eltwise_injector->compute_vector_range(k * jcp.ur_w,
                 k * jcp.ur_w + ur_w);
 }
 
+template<typename Vmm>
+void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::apply_post_ops(
+        int ur_w, bool last_oc_block_flag) {
+    int nb_oc_block
+            = jcp.is_depthwise ? jcp.nb_ch_blocking : jcp.nb_oc_blocking;
+    int oc_block = jcp.is_depthwise ? jcp.ch_block : jcp.oc_block;
+    const auto &p = attr_.post_ops_;
+
+    auto output_offset = [&](int j, int k) {
+        return k * oc_block + j * jcp.oc_without_padding * jcp.ngroups;
+    };
+    auto load_per_oc_base = [&](const Reg64 &reg_base) {
+        mov(reg_po_off, ptr[param1 + GET_OFF(oc_l_off)]);
+        lea(reg_po_rhs, ptr[reg_base + reg_po_off * sizeof(float)]);
+    };
+
+    for (int i = 0; i < p.len_; i++) {
+        const auto &e = p.entry_[i];
+        if (e.is_eltwise()) {
+            compute_eltwise(ur_w, i);
+        } else if (e.is_sum()) {
+            const float *p_sum_scale = &e.sum.scale;
+            if (*p_sum_scale != 1.f)
+                mov(reg_ptr_sum_scale, (size_t)p_sum_scale);
+            for (int k = 0; k < nb_oc_block; k++) {
+                const bool mask_flag
+                        = last_oc_block_flag && k == nb_oc_block - 1;
+                for (int j = 0; j < ur_w; j++) {
+                    int aux_output_offset
+                            = jcp.typesize_out * output_offset(j, k);
+                    auto addr = EVEX_compress_addr(reg_out, aux_output_offset);
+                    Vmm vmm = vmm_out(j, k);
+                    cvt2ps(jcp.dst_dt, vmm_prev_dst, addr, mask_flag);
+                    if (*p_sum_scale == 1.f)
+                        vaddps(vmm, vmm_prev_dst);
+                    else
+                        vfmadd231ps(vmm, vmm_prev_dst,
+                                zword_b[reg_ptr_sum_scale]);
+                }
+            }
+        } else if (e.is_scale_shift()) {
+            const bool per_oc = e.scale_shift.mask != 0;
+            const int shifts_off = e.scale_shift.count * sizeof(float);
+
+            mov(reg_po_rhs, reinterpret_cast<size_t>(e.scale_shift.scales));
+            if (per_oc) load_per_oc_base(reg_po_rhs);
+
+            for (int k = 0; k < nb_oc_block; k++) {
+                const bool mask_flag
+                        = last_oc_block_flag && k == nb_oc_block - 1;
+                if (per_oc) {
+                    const int off = sizeof(float) * k * oc_block;
+                    cvt2ps(data_type::f32, vmm_po_scale,
+                            EVEX_compress_addr(reg_po_rhs, off), mask_flag);
+                    cvt2ps(data_type::f32, vmm_po_rhs,
+                            EVEX_compress_addr(reg_po_rhs, shifts_off + off),
+                            mask_flag);
+                } else {
+                    vbroadcastss(vmm_po_scale, ptr[reg_po_rhs]);
+                    vbroadcastss(vmm_po_rhs, ptr[reg_po_rhs + shifts_off]);
+                }
+                for (int j = 0; j < ur_w; j++)
+                    vfmadd213ps(vmm_out(j, k), vmm_po_scale, vmm_po_rhs);
+            }
+        } else if (e.is_binary()) {
+            const auto &src1_md = e.binary.src1_desc;
+            const auto bcast = get_binary_po_bcast(src1_md,
+                    jcp.ngroups * jcp.oc_without_padding);
+            const int typesize_rhs
+                    = types::data_type_size(src1_md.data_type);
+
+            mov(reg_po_rhs,
+                    ptr[param1 + GET_OFF(post_ops_binary_rhs_arg_vec)]);
+            mov(reg_po_rhs, ptr[reg_po_rhs + i * sizeof(void *)]);
+            if (bcast == binary_po_bcast_per_oc) {
+                load_per_oc_base(reg_po_rhs);
+            } else if (bcast == binary_po_bcast_none) {
+                /* src1 has the layout of dst, but maybe not its data type */
+                mov(reg_po_off, reg_out);
+                sub(reg_po_off, ptr[param1 + GET_OFF(dst_orig)]);
+                if (typesize_rhs > jcp.typesize_out)
+                    shl(reg_po_off, 2);
+                else if (typesize_rhs < jcp.typesize_out)
+                    shr(reg_po_off, 2);
+                add(reg_po_rhs, reg_po_off);
+            }
+
+            for (int k = 0; k < nb_oc_block; k++) {
+                const bool mask_flag
+                        = last_oc_block_flag && k == nb_oc_block - 1;
+                if (bcast == binary_po_bcast_scalar)
+                    vbroadcastss(vmm_po_rhs, ptr[reg_po_rhs]);
+                else if (bcast == binary_po_bcast_per_oc)
+                    cvt2ps(data_type::f32, vmm_po_rhs,
+                            EVEX_compress_addr(reg_po_rhs,
+                                sizeof(float) * k * oc_block),
+                            mask_flag);
+                for (int j = 0; j < ur_w; j++) {
+                    Vmm vmm = vmm_out(j, k);
+                    if (bcast == binary_po_bcast_none)
+                        cvt2ps(src1_md.data_type, vmm_po_rhs,
+                                EVEX_compress_addr(reg_po_rhs,
+                                    typesize_rhs * output_offset(j, k)),
+                                mask_flag);
+                    switch (e.binary.alg) {
+                    case alg_kind::binary_add:
+                        vaddps(vmm, vmm, vmm_po_rhs); break;
+                    case alg_kind::binary_mul:
+                        vmulps(vmm, vmm, vmm_po_rhs); break;
+                    case alg_kind::binary_max:
+                        vmaxps(vmm, vmm, vmm_po_rhs); break;
+                    case alg_kind::binary_min:
+                        vminps(vmm, vmm, vmm_po_rhs); break;
+                    default: assert(!"unsupported binary alg");
+                    }
+                }
+            }
+        }
+    }
+}
+
 template<typename Vmm>
 void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
         int ur_w, bool last_oc_block_flag) {
@@ -141,17 +247,6 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
     if (jcp.signed_input)
         mov(reg_compensation, ptr[param1 + GET_OFF(compensation)]);
 
-    const auto &p = attr_.post_ops_;
-    const int sum_idx = p.find(primitive_kind::sum);
-    const float *p_sum_scale = nullptr;
-    if (sum_idx != -1) {
-        const auto &p_entry = p.entry_[sum_idx];
-        p_sum_scale = &p_entry.sum.scale;
-    }
-
-    if (p_sum_scale && *p_sum_scale != 1.f)
-        mov(reg_ptr_sum_scale, (size_t)p_sum_scale);
-
     if (jcp.signed_input && jcp.ver != ver_vnni) {
         /* put 'wei_adj_scale = 0.5' for bias calculation */
         mov(reg_bias_alpha, float2int(jcp.wei_adj_scale));
@@ -195,26 +290,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
     }
 
     /* Do post-ops */
-    if (maybe_eltwise(0)) compute_eltwise(ur_w);
-    if (p_sum_scale) { // post_op: sum
-        for (int k = 0; k < nb_oc_block; k++) {
-            const bool mask_flag = last_oc_block_flag && k == nb_oc_block - 1;
-            for (int j = 0; j < ur_w; j++) {
-                int aux_output_offset
-                        = jcp.typesize_out
-                        * (k * oc_block
-                                  + j * jcp.oc_without_padding * jcp.ngroups);
-                auto addr = EVEX_compress_addr(reg_out, aux_output_offset);
-                Vmm vmm = vmm_out(j, k);
-                cvt2ps(jcp.dst_dt, vmm_prev_dst, addr, mask_flag);
-                if (*p_sum_scale == 1.f)
-                    vaddps(vmm, vmm_prev_dst);
-                else
-                    vfmadd231ps(vmm, vmm_prev_dst, zword_b[reg_ptr_sum_scale]);
-            }
-        }
-    }
-    if (maybe_eltwise(1)) compute_eltwise(ur_w);
+    apply_post_ops(ur_w, last_oc_block_flag);
 
     /* write out register to output_addr */
     for (int k = 0; k < nb_oc_block; k++) {
@@ -835,8 +911,9 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::generate()
     }
     postamble();
 
-    if (jcp.with_eltwise)
-        eltwise_injector_->prepare_table();
+    for (size_t i = 0; i < eltwise_injectors_.size(); i++)
+        if (eltwise_injectors_[i])
+            eltwise_injectors_[i]->prepare_table();
 
     if (jcp.is_fast_depthwise) {
         align(64);
@@ -851,20 +928,18 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::generate()
 bool jit_avx512_core_x8s8s32x_fwd_kernel::post_ops_ok(
         jit_conv_conf_t &jcp, const primitive_attr_t &attr)
 {
-    using namespace primitive_kind;
     const auto &p = attr.post_ops_;
-
-    auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
-
-    switch (p.len_) {
-    case 0: return true;
-    case 1: return is_eltwise(0) || p.contain(sum, 0);
-    case 2: return (p.contain(sum, 0) && is_eltwise(1)) ||
-                        (p.contain(sum, 1) && is_eltwise(0));
-    default: return false;
+    if (p.find(primitive_kind::binary) != -1 && p.len_ > binary_po_max_len)
+        return false;
+
+    for (int i = 0; i < p.len_; i++) {
+        const auto &e = p.entry_[i];
+        const bool ok = e.is_eltwise() || e.is_sum() || e.is_scale_shift()
+            || e.is_binary();
+        if (!ok) return false;
     }
 
-    return false;
+    return true;
 }
 
 status_t jit_avx512_core_x8s8s32x_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
@@ -1032,6 +1107,16 @@ status_t jit_avx512_core_x8s8s32x_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
     if (jcp.dst_tag != dat_tag)
         return status::unimplemented;
 
+    for (int i = 0; i < p.len_; i++) {
+        const auto &e = p.entry_[i];
+        if (!e.is_binary()) continue;
+        const auto &src1_md = e.binary.src1_desc;
+        bool ok = binary_po_src1_ok(src1_md, dst_md)
+            && utils::one_of(src1_md.data_type, data_type::f32, data_type::s8,
+                    data_type::u8);
+        if (!ok) return status::unimplemented;
+    }
+
     if (jcp.with_bias) {
         if (bias_d.format_kind() == format_kind::any)
             CHECK(memory_desc_init_by_tag(bias_md, format_tag::x));
@@ -35,19 +35,22 @@ struct _jit_avx512_core_x8s8s32x_fwd_kernel : public jit_generator {
     enum { STATE_FIRST_DST_LOAD = 0x1U };
 
     _jit_avx512_core_x8s8s32x_fwd_kernel(jit_conv_conf_t ajcp,
-            const primitive_attr_t &attr) : jcp(ajcp), attr_(attr),
-            eltwise_injector_(nullptr)
+            const primitive_attr_t &attr) : jcp(ajcp), attr_(attr)
     {
-        if (jcp.with_eltwise)
-            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
-                this, jcp.eltwise);
+        const auto &p = attr_.post_ops_;
+        for (int i = 0; i < p.len_; i++)
+            eltwise_injectors_.push_back(p.entry_[i].is_eltwise()
+                    ? new jit_uni_eltwise_injector_f32<avx512_common>(
+                            this, p.entry_[i].eltwise)
+                    : nullptr);
 
         generate();
         jit_ker_ = (void (*)(jit_conv_call_s *))getCode();
     }
 
     ~_jit_avx512_core_x8s8s32x_fwd_kernel() {
-        delete eltwise_injector_;
+        for (size_t i = 0; i < eltwise_injectors_.size(); i++)
+            delete eltwise_injectors_[i];
     }
 
     jit_conv_conf_t jcp;
@@ -55,7 +58,9 @@ struct _jit_avx512_core_x8s8s32x_fwd_kernel : public jit_generator {
     void (*jit_ker_)(jit_conv_call_s *);
 
 private:
-    jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
+    /* one injector per eltwise post-op, nullptr for the other entries */
+    nstl::vector<jit_uni_eltwise_injector_f32<avx512_common> *>
+        eltwise_injectors_;
 
     enum {
         typesize = sizeof(float),
@@ -87,6 +92,9 @@ private:
     const Xbyak::Reg64 reg_kj = reg_ptr_scales;
     const Xbyak::Reg64 reg_overflow = reg_ptr_scales;
     const Xbyak::Reg64 reg_icb = reg_bias;
+    /* used during post-ops section of store_output */
+    const Xbyak::Reg64 reg_po_rhs = reg_bias;
+    const Xbyak::Reg64 reg_po_off = reg_compensation;
 
     const Xbyak::Opmask ktail_mask = Xbyak::Opmask(2);
     const Xbyak::Opmask kblend_mask = Xbyak::Opmask(3);
@@ -95,8 +103,10 @@ private:
     /* used during bias section of store_output */
     const Vmm vmm_comp = Vmm(30); // only for signed input
     const Vmm vmm_bias = Vmm(31);
-    /* used during post_op sum section of store_output */
+    /* used during post-ops section of store_output */
     const Vmm vmm_prev_dst = Vmm(31);
+    const Vmm vmm_po_rhs = Vmm(31);
+    const Vmm vmm_po_scale = Vmm(30);
     /* used during write-out section of store_output */
     const Vmm vmm_zero = Vmm(31);
 
@@ -156,14 +166,14 @@ private:
                                            jcp.stride_w));
     }
 
-    bool maybe_eltwise(int position);
     void prepare_output(int ur_w);
+    void apply_post_ops(int ur_w, bool last_oc_block_flag);
     void store_output(int ur_w, bool last_oc_block_flag);
     void compute_ker_dw(
             int ur_w, int pad_l, int pad_r, ic_block_t last_ic_block_flag, bool h_padded);
     void compute_ker(int ur_w, int pad_l, int pad_r,
             ic_block_t last_ic_block_flag, bool h_padded = false);
-    void compute_eltwise(int ur_w);
+    void compute_eltwise(int ur_w, int po_idx);
     void kh_loop(int ur_w, int pad_l, int pad_r, ic_block_t last_ic_block_flag);
     void icb_loop(
             int ur_w, int pad_l, int pad_r, bool is_last_spatial_block);
@@ -45,6 +45,9 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     auto weights = CTX_IN_MEM(const wei_data_t *, MKLDNN_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const char *, MKLDNN_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, MKLDNN_ARG_DST);
+    const void *post_ops_binary_rhs_buf[binary_po_max_len];
+    const auto post_ops_binary_rhs
+        = binary_po_rhs(ctx, post_ops_binary_rhs_buf);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
@@ -88,6 +91,8 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
         balance211(work_amount, nthr, ithr, start, end);
 
         auto p = jit_conv_call_s();
+        p.dst_orig = dst;
+        p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs;
 
         int n{ 0 }, gg{ 0 }, occ{ 0 }, owb{ 0 };
         switch (jcp.loop_order) {
@@ -124,6 +129,7 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
             p.src = src + src_d.blk_off(n, g_ic, iw_s);
             p.filt = weights + wht_blk_off(weights_d, gb, ocb, 0);
             p.scales = &oscales[jcp.is_oc_scale * g_oc];
+            p.oc_l_off = g_oc;
             p.oc_blocks = jcp.is_depthwise ? gb : ocb;
             p.kh_padding = jcp.kh;
             p.t_overflow = 0;
@@ -163,6 +169,9 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     auto weights = CTX_IN_MEM(const wei_data_t *, MKLDNN_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const char *, MKLDNN_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, MKLDNN_ARG_DST);
+    const void *post_ops_binary_rhs_buf[binary_po_max_len];
+    const auto post_ops_binary_rhs
+        = binary_po_rhs(ctx, post_ops_binary_rhs_buf);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
@@ -207,6 +216,8 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
         balance211(work_amount, nthr, ithr, start, end);
 
         auto p = jit_conv_call_s();
+        p.dst_orig = dst;
+        p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs;
 
         size_t src_h_stride = src_d.blk_off(0, 0, 1);
         size_t dst_h_stride = dst_d.blk_off(0, 0, 1);
@@ -277,6 +288,7 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
                     p.oc_blocks = ocb;
                     p.kh_padding = kh_padding;
                     p.scales = scales;
+                    p.oc_l_off = g_oc;
                     p.t_overflow = i_t_overflow;
                     p.b_overflow = i_b_overflow;
                     p.owb = owb;
@@ -313,6 +325,9 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     auto weights = CTX_IN_MEM(const wei_data_t *, MKLDNN_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const char *, MKLDNN_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, MKLDNN_ARG_DST);
+    const void *post_ops_binary_rhs_buf[binary_po_max_len];
+    const auto post_ops_binary_rhs
+        = binary_po_rhs(ctx, post_ops_binary_rhs_buf);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
@@ -356,6 +371,8 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
             [&](int n, int oh_s, int owb, int gg) {
 
         auto p = jit_conv_call_s();
+        p.dst_orig = dst;
+        p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs;
 
         size_t src_h_stride = src_d.blk_off(0, 0, 1);
         size_t wht_h_stride = wht_blk_off(weights_d, 0, 0, 0, 1);
@@ -392,6 +409,7 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
         p.oc_blocks = gb;
         p.kh_padding = kh_padding;
         p.scales = scales;
+        p.oc_l_off = g;
         p.t_overflow = i_t_overflow;
         p.b_overflow = i_b_overflow;
         p.owb = owb;
@@ -53,6 +53,45 @@ enum {
                                     pass */
 };
 
+/* How src1 of a binary post-op broadcasts to dst */
+enum binary_po_bcast_t {
+    binary_po_bcast_scalar, /* f32, a single value for the whole dst */
+    binary_po_bcast_per_oc, /* f32, a dense vector of output channels */
+    binary_po_bcast_none, /* the same dims and layout as dst */
+};
+
+inline binary_po_bcast_t get_binary_po_bcast(const memory_desc_t &src1_md,
+        dim_t dst_oc) {
+    const memory_desc_wrapper src1_d(&src1_md);
+    bool all_ones = true;
+    bool per_oc = src1_d.ndims() > 1 && src1_d.dims()[1] == dst_oc;
+    for (int d = 0; d < src1_d.ndims(); ++d) {
+        all_ones = all_ones && src1_d.dims()[d] == 1;
+        per_oc = per_oc && (d == 1 || src1_d.dims()[d] == 1);
+    }
+
+    const bool f32_plain = src1_d.data_type() == data_type::f32
+        && src1_d.is_plain() && src1_d.is_dense() && src1_d.offset0() == 0;
+    if (all_ones && f32_plain) return binary_po_bcast_scalar;
+    if (per_oc && f32_plain) return binary_po_bcast_per_oc;
+    return binary_po_bcast_none;
+}
+
+/* The kernels take src1 of the binary post-ops from an on-stack array
+ * indexed by the post-op position, hence a cap on the chain length */
+enum { binary_po_max_len = 32 };
+
+/* src1 of a binary post-op must either broadcast or be laid out as dst */
+inline bool binary_po_src1_ok(const memory_desc_t &src1_md,
+        const memory_desc_t &dst_md) {
+    const memory_desc_wrapper src1_d(&src1_md), dst_d(&dst_md);
+    if (src1_d.ndims() != dst_d.ndims()) return false;
+    if (get_binary_po_bcast(src1_md, dst_d.dims()[1]) != binary_po_bcast_none)
+        return true;
+    return src1_d.similar_to(dst_d, true, false)
+        && src1_d.offset0() == dst_d.offset0();
+}
+
 struct jit_conv_conf_t {
     prop_kind_t prop_kind;
     conv_version_t ver;
@@ -130,6 +169,10 @@ struct jit_conv_conf_t {
     // s8s8 convolution
     bool signed_input;
     float wei_adj_scale;
+    // bf16 convolution
+    data_type_t dsrc_dt;
+    data_type_t dwei_dt;
+    int ic_block_step;
 };
 
 struct jit_conv_conf_2x3_wino_t {
@@ -298,6 +341,12 @@ struct jit_conv_call_s {
     size_t t_overflow;
     size_t b_overflow;
     int flags;
+
+    /* binary and per-channel post-ops */
+    const void *dst_orig;
+    const void *post_ops_binary_rhs_arg_vec;
+    size_t oc_l_off;
+    size_t oc_l_off_prf;
 };
 
 struct jit_deconv_call_s {
@@ -356,6 +405,7 @@ struct jit_1x1_conv_conf_t {
     bool with_bias;
     bool with_sum;
     bool with_eltwise;
+    bool with_dw_conv;
 
     post_ops_t::entry_t::eltwise_t eltwise;
 
@@ -364,6 +414,10 @@ struct jit_1x1_conv_conf_t {
 
     int ur, ur_tail;
 
+    /* rows of the per-thread buffer the output goes to when a depthwise
+     * convolution is fused */
+    int dw_conv_buffer_oh;
+
     int reduce_dim, reduce_block, nb_reduce,
         nb_reduce_blocking, nb_reduce_blocking_max;
     int load_dim, load_block, nb_load,
@@ -483,6 +537,73 @@ struct jit_pool_call_s {
     float ker_area_h;
 };
 
+/* softmax */
+struct jit_softmax_conf_t {
+    bool is_fwd;
+    bool is_logsoftmax;
+    /* true: the axis is contiguous and is reduced within vector registers,
+     *       one point (an outer x inner position) at a time;
+     * false: the inner points are contiguous and simd_w of them are
+     *        processed at once, elementwise along the axis */
+    bool axis_is_vec;
+    int simd_w;
+
+    dim_t outer_size, axis_size, inner_size;
+    dim_t inner_chunk; /* number of points in a unit of work */
+    dim_t inner_stride; /* distance between consecutive points */
+
+    /* axis_is_vec: the axis consists of nb_blk blocks (blk_stride apart) of
+     * blk_nvec full vectors each, followed by axis_tail scalars at tail_off */
+    dim_t nb_blk, blk_nvec, blk_stride;
+    dim_t axis_tail, tail_off;
+
+    /* !axis_is_vec: distance between consecutive elements of the axis */
+    dim_t axis_stride;
+};
+
+struct jit_softmax_call_s {
+    const float *src;
+    const float *dst;
+    const float *diff_dst;
+    const float *diff_src;
+    size_t work_amount;
+};
+
+/* binary */
+enum binary_layout_t {
+    binary_flat, /* src0, src1 (unless broadcast) and dst as 1D arrays */
+    binary_ncsp, /* plain, broadcast along the spatial dimensions */
+    binary_nspc, /* channels last, broadcast along the spatial dimensions */
+    binary_nCspBc, /* channels blocked by simd_w, broadcast along spatial */
+};
+enum binary_bcast_t {
+    binary_bcast_none, /* src1 is streamed along with src0 */
+    binary_bcast_scalar, /* a single f32 value for the whole call */
+    binary_bcast_vector, /* a single vector of f32 for the whole call */
+};
+
+struct jit_binary_conf_t {
+    alg_kind_t alg;
+    data_type_t src0_dt, src1_dt, dst_dt;
+    int simd_w;
+
+    binary_layout_t layout;
+    binary_bcast_t bcast;
+
+    dim_t nelems; /* binary_flat: with padding */
+
+    /* all but binary_flat: src1 is converted to N1 x C_pad f32 values */
+    dim_t N, C, C_pad, SP, N1;
+    dim_t blk;
+};
+
+struct jit_binary_call_s {
+    const void *src0;
+    const void *src1;
+    void *dst;
+    size_t work_amount;
+};
+
 
 }
 }
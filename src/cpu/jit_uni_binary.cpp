@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "c_types_map.hpp"
+#include "math_utils.hpp"
+#include "mkldnn_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "jit_uni_binary.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+
+template <cpu_isa_t isa>
+void jit_uni_binary_t<isa>::execute_forward(const exec_ctx_t &ctx) const {
+    auto src0 = CTX_IN_MEM(const char *, MKLDNN_ARG_SRC_0);
+    auto src1 = CTX_IN_MEM(const char *, MKLDNN_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(char *, MKLDNN_ARG_DST);
+
+    const memory_desc_wrapper src0_d(pd()->src_md(0));
+    const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto &jbp = pd()->jbp_;
+    const size_t src0_sz = src0_d.data_type_size();
+    const size_t dst_sz = dst_d.data_type_size();
+
+    /* off is the offset of the first element relative to offset0(), the
+     * same for src0 and dst since they share the layout */
+    auto ker = [&](dim_t off, const void *s1, size_t work_amount) {
+        jit_binary_call_s arg = {};
+        arg.src0 = src0 + (src0_d.offset0() + off) * src0_sz;
+        arg.src1 = s1;
+        arg.dst = dst + (dst_d.offset0() + off) * dst_sz;
+        arg.work_amount = work_amount;
+        (*kernel_)(&arg);
+    };
+
+    if (jbp.layout == binary_flat) {
+        const float scalar = jbp.bcast == binary_bcast_scalar
+            ? math::get_bias(src1, src1_d.offset0(), src1_d.data_type())
+            : 0.f;
+        const size_t src1_sz = src1_d.data_type_size();
+        const dim_t nvec = utils::div_up(jbp.nelems, jbp.simd_w);
+
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t start{0}, end{0};
+            balance211(nvec, nthr, ithr, start, end);
+            if (start >= end) return;
+
+            const dim_t off = start * jbp.simd_w;
+            const dim_t work_amount
+                = nstl::min(end * jbp.simd_w, jbp.nelems) - off;
+            const void *s1 = jbp.bcast == binary_bcast_scalar
+                ? (const void *)&scalar
+                : src1 + (src1_d.offset0() + off) * src1_sz;
+            ker(off, s1, (size_t)work_amount);
+        });
+        return;
+    }
+
+    /* src1 as N1 x C_pad f32 values, zeros in the padded channels */
+    float *bcast = scratchpad(ctx).template get<float>(key_binary_bcast);
+    const bool bcast_c = pd()->is_broadcast_dim(1);
+    parallel_nd(jbp.N1, jbp.C_pad, [&](dim_t n1, dim_t c) {
+        float val = 0.f;
+        if (c < jbp.C) {
+            dims_t pos = {};
+            pos[0] = n1;
+            pos[1] = bcast_c ? 0 : c;
+            val = math::get_bias(src1, src1_d.off_v(pos),
+                    src1_d.data_type());
+        }
+        bcast[n1 * jbp.C_pad + c] = val;
+    });
+
+    auto bcast_row = [&](dim_t n) {
+        return &bcast[(jbp.N1 == 1 ? 0 : n) * jbp.C_pad];
+    };
+
+    switch (jbp.layout) {
+    case binary_ncsp:
+        parallel_nd(jbp.N, jbp.C, [&](dim_t n, dim_t c) {
+            ker((n * jbp.C + c) * jbp.SP, bcast_row(n) + c, (size_t)jbp.SP);
+        });
+        break;
+    case binary_nspc:
+        parallel_nd(jbp.N, jbp.SP, [&](dim_t n, dim_t sp) {
+            ker((n * jbp.SP + sp) * jbp.C, bcast_row(n), (size_t)jbp.C);
+        });
+        break;
+    case binary_nCspBc:
+        parallel_nd(jbp.N, jbp.C_pad / jbp.blk, [&](dim_t n, dim_t cb) {
+            ker((n * jbp.C_pad + cb * jbp.blk) * jbp.SP,
+                    bcast_row(n) + cb * jbp.blk,
+                    (size_t)(jbp.SP * jbp.blk));
+        });
+        break;
+    default: assert(!"unknown layout");
+    }
+}
+
+template struct jit_uni_binary_t<avx2>;
+template struct jit_uni_binary_t<avx512_common>;
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
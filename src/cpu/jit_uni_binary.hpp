@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_JIT_UNI_BINARY_HPP
+#define CPU_JIT_UNI_BINARY_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "memory_tracking.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_binary_pd.hpp"
+#include "cpu_primitive.hpp"
+
+#include "jit_uni_binary_kernel.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+template <cpu_isa_t isa>
+struct jit_uni_binary_t: public cpu_primitive_t {
+    struct pd_t: public cpu_binary_pd_t {
+        using cpu_binary_pd_t::cpu_binary_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_binary_t<isa>);
+
+        status_t init() {
+            bool ok = true
+                && mayiuse(isa)
+                && set_default_params() == status::success;
+            if (!ok) return status::unimplemented;
+
+            status_t status = jit_uni_binary_kernel<isa>::init_conf(jbp_,
+                    this);
+            if (status != status::success) return status;
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        jit_binary_conf_t jbp_;
+
+    private:
+        void init_scratchpad() {
+            if (jbp_.layout == binary_flat) return;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book(memory_tracking::names::key_binary_bcast,
+                    sizeof(float) * jbp_.N1 * jbp_.C_pad);
+        }
+    };
+
+    jit_uni_binary_t(const pd_t *apd): cpu_primitive_t(apd) {
+        kernel_ = new jit_uni_binary_kernel<isa>(pd()->jbp_,
+                pd()->attr()->post_ops_);
+    }
+
+    ~jit_uni_binary_t() { delete kernel_; }
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd(); }
+    jit_uni_binary_kernel<isa> *kernel_;
+};
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
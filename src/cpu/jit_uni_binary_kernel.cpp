@@ -0,0 +1,378 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "c_types_map.hpp"
+#include "math_utils.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "jit_uni_binary_kernel.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_binary_call_s, field)
+
+template <cpu_isa_t isa>
+jit_uni_binary_kernel<isa>::jit_uni_binary_kernel(
+        const jit_binary_conf_t &ajbp, const post_ops_t &post_ops)
+    : jbp(ajbp), bf16_emu_(nullptr)
+{
+    for (int i = 0; i < post_ops.len_; ++i)
+        eltwise_injectors_.push_back(new jit_uni_eltwise_injector_f32<isa>(
+                    this, post_ops.entry_[i].eltwise, true, reg_table));
+
+    if (jbp.dst_dt == data_type::bf16 && !mayiuse(avx512_core_bf16))
+        bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
+                bf16_emu_reserv_2, bf16_emu_reserv_3, reg_bf16_scratch,
+                bf16_emu_reserv_4);
+
+    this->generate();
+    jit_ker = (decltype(jit_ker))this->getCode();
+}
+
+template <cpu_isa_t isa>
+jit_uni_binary_kernel<isa>::~jit_uni_binary_kernel() {
+    for (auto inj: eltwise_injectors_)
+        delete inj;
+    delete bf16_emu_;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_binary_kernel<isa>::init_conf(jit_binary_conf_t &jbp,
+        const binary_pd_t *bpd) {
+    using namespace data_type;
+    using namespace format_tag;
+    using namespace utils;
+
+    const memory_desc_wrapper src0_d(bpd->src_md(0));
+    const memory_desc_wrapper src1_d(bpd->src_md(1));
+    const memory_desc_wrapper dst_d(bpd->dst_md());
+
+    jbp.alg = bpd->alg_kind();
+    jbp.src0_dt = src0_d.data_type();
+    jbp.src1_dt = src1_d.data_type();
+    jbp.dst_dt = dst_d.data_type();
+    jbp.simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    const bool is_bf16 = one_of(bf16, jbp.src0_dt, jbp.src1_dt, jbp.dst_dt);
+    const bool is_padded = dst_d.nelems(true) != dst_d.nelems();
+
+    bool ok = true
+        && mayiuse(isa)
+        && everyone_is(true, one_of(jbp.src0_dt, f32, bf16, s8, u8),
+                one_of(jbp.src1_dt, f32, bf16, s8, u8),
+                one_of(jbp.dst_dt, f32, bf16, s8, u8))
+        && IMPLICATION(is_bf16, isa == avx512_common && mayiuse(avx512_core))
+        && !dst_d.has_zero_dim()
+        && src0_d.is_blocking_desc()
+        && src1_d.is_blocking_desc()
+        && src0_d.is_dense(true)
+        && dst_d.similar_to(src0_d, true, false)
+        && bpd->attr()->output_scales_.has_default_values();
+    if (!ok) return status::unimplemented;
+
+    /* the padded area of dst has to stay zero */
+    const auto &p = bpd->attr()->post_ops_;
+    for (int i = 0; i < p.len_; ++i) {
+        if (!p.entry_[i].is_eltwise()) return status::unimplemented;
+        if (is_padded && !math::eltwise_fwd_preserves_zero(
+                    p.entry_[i].eltwise.alg, true))
+            return status::unimplemented;
+    }
+
+    jbp.nelems = dst_d.nelems(true);
+    jbp.N = jbp.C = jbp.C_pad = jbp.SP = jbp.N1 = 0;
+    jbp.blk = 1;
+
+    if (bpd->is_tensor_op() && src1_d.similar_to(src0_d, true, false)) {
+        jbp.layout = binary_flat;
+        jbp.bcast = binary_bcast_none;
+        return status::success;
+    }
+
+    /* src1 is converted to f32 by the driver in all the cases below */
+    jbp.src1_dt = f32;
+
+    if (src1_d.nelems() == 1 && !is_padded) {
+        jbp.layout = binary_flat;
+        jbp.bcast = binary_bcast_scalar;
+        return status::success;
+    }
+
+    /* broadcast along the spatial dimensions (and possibly the batch and
+     * channels) */
+    const int ndims = bpd->ndims();
+    if (ndims < 2) return status::unimplemented;
+    for (int d = 2; d < ndims; ++d)
+        if (src1_d.dims()[d] != 1) return status::unimplemented;
+
+    jbp.N = dst_d.dims()[0];
+    jbp.C = dst_d.dims()[1];
+    jbp.C_pad = dst_d.padded_dims()[1];
+    jbp.SP = array_product(dst_d.dims() + 2, ndims - 2);
+    jbp.N1 = src1_d.dims()[0];
+
+    const bool is_ncsp = src0_d.matches_one_of_tag(ab, abc, abcd, abcde)
+        != format_tag::undef;
+    const bool is_nspc = src0_d.matches_one_of_tag(acb, acdb, acdeb)
+        != format_tag::undef;
+    const bool is_blocked = (jbp.simd_w == 16
+        ? src0_d.matches_one_of_tag(aBc16b, aBcd16b, aBcde16b)
+        : src0_d.matches_one_of_tag(aBc8b, aBcd8b, aBcde8b))
+        != format_tag::undef;
+
+    if (is_ncsp) {
+        /* with a single spatial point ncsp is nspc */
+        jbp.layout = jbp.SP == 1 ? binary_nspc : binary_ncsp;
+        jbp.bcast = jbp.SP == 1 ? binary_bcast_none : binary_bcast_scalar;
+    } else if (is_nspc) {
+        jbp.layout = binary_nspc;
+        jbp.bcast = binary_bcast_none;
+    } else if (is_blocked) {
+        jbp.layout = binary_nCspBc;
+        jbp.bcast = binary_bcast_vector;
+        jbp.blk = jbp.simd_w;
+    } else {
+        return status::unimplemented;
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_binary_kernel<isa>::load(const Vmm &v, const Reg64 &base,
+        int off, data_type_t dt, bool tail) {
+    using namespace data_type;
+
+    const auto a = ptr[base + off];
+    const Xmm x(v.getIdx());
+    if (!tail) {
+        switch (dt) {
+        case f32: uni_vmovups(v, a); break;
+        case bf16: vpmovzxwd(v, a); vpslld(v, v, 16); break;
+        case s8: vpmovsxbd(v, a); vcvtdq2ps(v, v); break;
+        case u8: vpmovzxbd(v, a); vcvtdq2ps(v, v); break;
+        default: assert(!"unsupported data type");
+        }
+        return;
+    }
+
+    switch (dt) {
+    case f32: vmovss(x, a); break;
+    case bf16:
+        movzx(reg_tmp.cvt32(), word[base + off]);
+        shl(reg_tmp.cvt32(), 16);
+        vmovd(x, reg_tmp.cvt32());
+        break;
+    case s8:
+        movsx(reg_tmp.cvt32(), byte[base + off]);
+        vmovd(x, reg_tmp.cvt32());
+        vcvtdq2ps(x, x);
+        break;
+    case u8:
+        movzx(reg_tmp.cvt32(), byte[base + off]);
+        vmovd(x, reg_tmp.cvt32());
+        vcvtdq2ps(x, x);
+        break;
+    default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_binary_kernel<isa>::store(const Reg64 &base, int off,
+        const Vmm &v, data_type_t dt, bool tail) {
+    using namespace data_type;
+
+    const auto a = ptr[base + off];
+    const Xmm x(v.getIdx());
+    const Ymm y(v.getIdx());
+    const Zmm z(v.getIdx());
+
+    if (dt == f32) {
+        if (tail) vmovss(a, x); else uni_vmovups(a, v);
+        return;
+    }
+
+    if (dt == bf16) {
+        if (bf16_emu_)
+            bf16_emu_->vcvtneps2bf16(y, z);
+        else
+            vcvtneps2bf16(y, z);
+        if (tail) {
+            vmovd(reg_tmp.cvt32(), x);
+            mov(a, reg_tmp.cvt16());
+        } else {
+            vmovups(a, y);
+        }
+        return;
+    }
+
+    /* s8 and u8: saturate and round in f32 first, so that the narrowing
+     * below is exact */
+    uni_vmaxps(v, v, vmm_sat_lo);
+    uni_vminps(v, v, vmm_sat_hi);
+    uni_vcvtps2dq(v, v);
+
+    if (tail) {
+        vmovd(reg_tmp.cvt32(), x);
+        mov(a, reg_tmp.cvt8());
+    } else if (isa == avx512_common) {
+        vpmovdb(a, z);
+    } else {
+        vextracti128(xmm_tmp, y, 1);
+        vpackssdw(x, x, xmm_tmp);
+        if (dt == s8)
+            vpacksswb(x, x, x);
+        else
+            vpackuswb(x, x, x);
+        vmovq(a, x);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_binary_kernel<isa>::compute(int ur, bool tail) {
+    using namespace alg_kind;
+
+    const int src0_sz = types::data_type_size(jbp.src0_dt);
+    const int src1_sz = types::data_type_size(jbp.src1_dt);
+    const int dst_sz = types::data_type_size(jbp.dst_dt);
+
+    for (int i = 0; i < ur; ++i) {
+        const int off = i * jbp.simd_w;
+        const Vmm x = vmm_src0(i);
+
+        load(x, reg_src0, off * src0_sz, jbp.src0_dt, tail);
+
+        Vmm y = vmm_bcast;
+        if (jbp.bcast == binary_bcast_none) {
+            y = vmm_src1(i);
+            load(y, reg_src1, off * src1_sz, jbp.src1_dt, tail);
+        }
+
+        switch (jbp.alg) {
+        case binary_add: uni_vaddps(x, x, y); break;
+        case binary_mul: uni_vmulps(x, x, y); break;
+        case binary_max: uni_vmaxps(x, x, y); break;
+        case binary_min: uni_vminps(x, x, y); break;
+        default: assert(!"unknown binary alg_kind");
+        }
+    }
+
+    for (auto inj: eltwise_injectors_)
+        inj->compute_vector_range(vmm_src0(0).getIdx(),
+                vmm_src0(ur).getIdx());
+
+    for (int i = 0; i < ur; ++i) {
+        const int off = i * jbp.simd_w;
+        store(reg_dst, off * dst_sz, vmm_src0(i), jbp.dst_dt, tail);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_binary_kernel<isa>::shift_pointers(int nelems) {
+    add(reg_src0, nelems * types::data_type_size(jbp.src0_dt));
+    add(reg_dst, nelems * types::data_type_size(jbp.dst_dt));
+    if (jbp.bcast == binary_bcast_none)
+        add(reg_src1, nelems * types::data_type_size(jbp.src1_dt));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_binary_kernel<isa>::generate() {
+    using namespace data_type;
+
+    preamble();
+
+    mov(reg_src0, ptr[reg_param + GET_OFF(src0)]);
+    mov(reg_src1, ptr[reg_param + GET_OFF(src1)]);
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    mov(reg_work_amount, ptr[reg_param + GET_OFF(work_amount)]);
+
+    if (bf16_emu_)
+        bf16_emu_->init_vcvtneps2bf16();
+
+    if (utils::one_of(jbp.dst_dt, s8, u8)) {
+        const float lo = jbp.dst_dt == s8 ? -128.f : 0.f;
+        const float hi = jbp.dst_dt == s8 ? 127.f : 255.f;
+        mov(reg_tmp.cvt32(), float2int(lo));
+        vmovd(xmm_tmp, reg_tmp.cvt32());
+        uni_vbroadcastss(vmm_sat_lo, xmm_tmp);
+        mov(reg_tmp.cvt32(), float2int(hi));
+        vmovd(xmm_tmp, reg_tmp.cvt32());
+        uni_vbroadcastss(vmm_sat_hi, xmm_tmp);
+    }
+
+    if (jbp.bcast == binary_bcast_scalar)
+        uni_vbroadcastss(vmm_bcast, ptr[reg_src1]);
+    else if (jbp.bcast == binary_bcast_vector)
+        uni_vmovups(vmm_bcast, ptr[reg_src1]);
+
+    Label unroll_loop_label, unroll_loop_end_label;
+    Label vec_loop_label, vec_loop_end_label;
+    Label tail_loop_label, tail_loop_end_label;
+
+    L(unroll_loop_label); {
+        cmp(reg_work_amount, unroll * jbp.simd_w);
+        jl(unroll_loop_end_label, T_NEAR);
+        compute(unroll, false);
+        shift_pointers(unroll * jbp.simd_w);
+        sub(reg_work_amount, unroll * jbp.simd_w);
+        jmp(unroll_loop_label, T_NEAR);
+    }
+    L(unroll_loop_end_label);
+
+    L(vec_loop_label); {
+        cmp(reg_work_amount, jbp.simd_w);
+        jl(vec_loop_end_label, T_NEAR);
+        compute(1, false);
+        shift_pointers(jbp.simd_w);
+        sub(reg_work_amount, jbp.simd_w);
+        jmp(vec_loop_label, T_NEAR);
+    }
+    L(vec_loop_end_label);
+
+    /* the tail is processed one element at a time, which is only correct
+     * for a broadcast value that is the same in every lane */
+    if (jbp.bcast != binary_bcast_vector) {
+        L(tail_loop_label); {
+            cmp(reg_work_amount, 0);
+            jle(tail_loop_end_label, T_NEAR);
+            compute(1, true);
+            shift_pointers(1);
+            dec(reg_work_amount);
+            jmp(tail_loop_label, T_NEAR);
+        }
+        L(tail_loop_end_label);
+    }
+
+    postamble();
+
+    for (auto inj: eltwise_injectors_)
+        inj->prepare_table();
+}
+
+template struct jit_uni_binary_kernel<avx2>;
+template struct jit_uni_binary_kernel<avx512_common>;
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_UNI_BINARY_KERNEL_HPP
+#define JIT_UNI_BINARY_KERNEL_HPP
+
+#include "c_types_map.hpp"
+#include "binary_pd.hpp"
+#include "type_helpers.hpp"
+
+#include "jit_avx512_core_bf16cvt.hpp"
+#include "jit_generator.hpp"
+#include "jit_primitive_conf.hpp"
+#include "jit_uni_eltwise.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+template <cpu_isa_t isa>
+struct jit_uni_binary_kernel: public jit_generator {
+    jit_uni_binary_kernel(const jit_binary_conf_t &ajbp,
+            const post_ops_t &post_ops);
+    ~jit_uni_binary_kernel();
+
+    jit_binary_conf_t jbp;
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_binary_kernel)
+
+    void operator()(jit_binary_call_s *arg) { jit_ker(arg); }
+    static status_t init_conf(jit_binary_conf_t &jbp,
+            const binary_pd_t *bpd);
+
+private:
+    using Vmm = typename utils::conditional<isa == avx2, Xbyak::Ymm,
+            Xbyak::Zmm>::type;
+
+    static constexpr int unroll = 4;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_param = abi_param1;
+
+    Xbyak::Reg64 reg_src0 = r8;
+    Xbyak::Reg64 reg_src1 = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_tmp = r12;
+    Xbyak::Reg64 reg_bf16_scratch = r13;
+    Xbyak::Reg64 reg_table = rax; /* used by the eltwise injectors */
+
+    /* Vmm(1 .. unroll) hold src0 and the result, Vmm(unroll + 1 .. 2 *
+     * unroll) src1 */
+    Vmm vmm_src0(int i) { return Vmm(1 + i); }
+    Vmm vmm_src1(int i) { return Vmm(1 + unroll + i); }
+    Vmm vmm_bcast = Vmm(2 * unroll + 1);
+    Vmm vmm_sat_lo = Vmm(2 * unroll + 2);
+    Vmm vmm_sat_hi = Vmm(2 * unroll + 3);
+    Xbyak::Xmm xmm_tmp = Xbyak::Xmm(2 * unroll + 4);
+
+    Xbyak::Zmm bf16_emu_reserv_1 = Xbyak::Zmm(26);
+    Xbyak::Zmm bf16_emu_reserv_2 = Xbyak::Zmm(27);
+    Xbyak::Zmm bf16_emu_reserv_3 = Xbyak::Zmm(28);
+    Xbyak::Zmm bf16_emu_reserv_4 = Xbyak::Zmm(29);
+
+    nstl::vector<jit_uni_eltwise_injector_f32<isa> *> eltwise_injectors_;
+    bf16_emulation_t *bf16_emu_;
+
+    void (*jit_ker)(jit_binary_call_s *);
+
+    void load(const Vmm &v, const Xbyak::Reg64 &base, int off,
+            data_type_t dt, bool tail);
+    void store(const Xbyak::Reg64 &base, int off, const Vmm &v,
+            data_type_t dt, bool tail);
+    void compute(int ur, bool tail);
+    void shift_pointers(int nelems);
+
+    void generate();
+};
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -555,7 +555,12 @@ void jit_uni_eltwise_injector_f32<isa>::elu_prepare_table() {
             0x3d2bb1b1, // [8] p4 = 0.041917507f
             0x3c091ec1, // [9] p5 = 0.008369149f
             0x42b0c0a5, //[10] max logf = 88.3762589f
-            0xc1766666, //[11] min logf = -14.5f
+            /* the exp algorithm (e.g. in softmax) must keep results down
+             * to the smallest normal number, the other algorithms saturate
+             * well before it */
+            alg_ == alg_kind::eltwise_exp
+                ? 0xc2aeac50u //[11] min logf = -87.3365447f
+                : 0xc1766666u, //[11] min logf = -14.5f
             // tanh(x) constants,
             0x80000000, //[12] mask to extract sign
             0x39ddb3d7, //[13] arg below which tanh(x) = x
@@ -654,6 +659,7 @@ int jit_uni_eltwise_injector_f32<isa>::aux_vecs_count(alg_kind_t alg_) {
     case alg_kind::eltwise_bounded_relu: return 0;
     case alg_kind::eltwise_soft_relu: return 4;
     case alg_kind::eltwise_logistic: return 4;
+    case alg_kind::eltwise_exp: return 2;
     default: assert(!"unsupported eltwise algorithm");
     }
 
@@ -679,6 +685,7 @@ void jit_uni_eltwise_injector_f32<isa>::compute_body(size_t start_idx,
         case eltwise_bounded_relu: bounded_relu_compute_vector(Vmm(idx)); break;
         case eltwise_soft_relu: soft_relu_compute_vector(Vmm(idx)); break;
         case eltwise_logistic: logistic_compute_vector(Vmm(idx)); break;
+        case eltwise_exp: exp_compute_vector(Vmm(idx)); break;
         default: assert(!"unsupported eltwise algorithm");
         }
     }
@@ -709,6 +716,7 @@ void jit_uni_eltwise_injector_f32<isa>::prepare_table(bool gen_table) {
         case eltwise_elu:
         case eltwise_tanh:
         case eltwise_logistic:
+        case eltwise_exp:
             elu_prepare_table(); break;
         case eltwise_soft_relu: soft_relu_prepare_table(); break;
         case eltwise_abs: abs_prepare_table(); break;
@@ -1076,7 +1084,8 @@ struct jit_uni_kernel_fwd : public jit_uni_eltwise_kernel,
         assert(is_bwd() == false);
         assert(utils::one_of(desc.alg_kind, eltwise_tanh, eltwise_elu,
                     eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_linear,
-                    eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic));
+                    eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic,
+                    eltwise_exp));
 
         preamble();
 
@@ -1211,7 +1220,7 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::init() {
         && utils::one_of(desc()->alg_kind, eltwise_relu, eltwise_tanh,
                 eltwise_elu, eltwise_square, eltwise_abs, eltwise_sqrt,
                 eltwise_linear, eltwise_bounded_relu, eltwise_soft_relu,
-                eltwise_logistic)
+                eltwise_logistic, eltwise_exp)
         && memory_desc_wrapper(src_md()).is_dense(true)
         && IMPLICATION(!memory_desc_wrapper(src_md()).is_dense(false),
                 math::eltwise_fwd_preserves_zero(desc()->alg_kind, true))
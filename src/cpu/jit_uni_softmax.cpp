@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "c_types_map.hpp"
+#include "mkldnn_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "jit_uni_softmax.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+namespace {
+/* Splits outer_size x inner_size points between the threads in units of
+ * inner_chunk points, and calls f(off, work_amount) for every run of points
+ * that shares the outer index; off is the offset of the first point. */
+template <typename F>
+void for_each_run(const jit_softmax_conf_t &jsp,
+        const memory_desc_wrapper &data_d, F f) {
+    const dim_t nb_chunks = utils::div_up(jsp.inner_size, jsp.inner_chunk);
+    const dim_t work_amount = jsp.outer_size * nb_chunks;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start{0}, end{0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        dim_t ou{0}, ic{0};
+        utils::nd_iterator_init(start, ou, jsp.outer_size, ic, nb_chunks);
+
+        while (start < end) {
+            const dim_t n_chunks = nstl::min(end - start, nb_chunks - ic);
+            const dim_t in = ic * jsp.inner_chunk;
+            const dim_t n_points = nstl::min(n_chunks * jsp.inner_chunk,
+                    jsp.inner_size - in);
+
+            f(data_d.off_l(ou * jsp.axis_size * jsp.inner_size + in),
+                    (size_t)n_points);
+
+            start += n_chunks;
+            ic = 0;
+            ++ou;
+        }
+    });
+}
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_fwd_t<isa>::execute_forward(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, MKLDNN_ARG_SRC);
+    auto dst = CTX_OUT_MEM(data_t *, MKLDNN_ARG_DST);
+
+    const memory_desc_wrapper data_d(pd()->src_md());
+
+    for_each_run(pd()->jsp_, data_d, [&](dim_t off, size_t work_amount) {
+        jit_softmax_call_s arg = {};
+        arg.src = &src[off];
+        arg.dst = &dst[off];
+        arg.work_amount = work_amount;
+        (*kernel_)(&arg);
+    });
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_bwd_t<isa>::execute_backward(
+        const exec_ctx_t &ctx) const {
+    auto dst = CTX_IN_MEM(const data_t *, MKLDNN_ARG_DST);
+    auto diff_dst = CTX_IN_MEM(const data_t *, MKLDNN_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(data_t *, MKLDNN_ARG_DIFF_SRC);
+
+    const memory_desc_wrapper data_d(pd()->diff_dst_md());
+
+    for_each_run(pd()->jsp_, data_d, [&](dim_t off, size_t work_amount) {
+        jit_softmax_call_s arg = {};
+        arg.dst = &dst[off];
+        arg.diff_dst = &diff_dst[off];
+        arg.diff_src = &diff_src[off];
+        arg.work_amount = work_amount;
+        (*kernel_)(&arg);
+    });
+}
+
+template struct jit_uni_softmax_fwd_t<sse41>;
+template struct jit_uni_softmax_fwd_t<avx2>;
+template struct jit_uni_softmax_fwd_t<avx512_common>;
+template struct jit_uni_softmax_bwd_t<sse41>;
+template struct jit_uni_softmax_bwd_t<avx2>;
+template struct jit_uni_softmax_bwd_t<avx512_common>;
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,452 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+#include <limits.h>
+
+#include "c_types_map.hpp"
+#include "nstl.hpp"
+#include "utils.hpp"
+
+#include "jit_uni_softmax_kernel_f32.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_softmax_call_s, field)
+
+template <cpu_isa_t isa>
+status_t jit_uni_softmax_kernel_f32<isa>::init_conf(jit_softmax_conf_t &jsp,
+        const softmax_pd_t *spd) {
+    using namespace utils;
+
+    const memory_desc_wrapper data_d(
+            spd->is_fwd() ? spd->src_md() : spd->diff_dst_md());
+
+    if (!data_d.is_blocking_desc() || data_d.has_zero_dim())
+        return status::unimplemented;
+
+    const int ndims = data_d.ndims();
+    const int axis = spd->axis();
+    const dims_t &dims = data_d.dims();
+    const auto &bd = data_d.blocking_desc();
+
+    jsp.is_fwd = spd->is_fwd();
+    jsp.is_logsoftmax = spd->is_logsoftmax();
+    jsp.simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    jsp.outer_size = array_product(dims, axis);
+    jsp.axis_size = dims[axis];
+    jsp.inner_size = array_product(dims + axis + 1, ndims - axis - 1);
+
+    /* only the axis may be blocked (and padded) */
+    if (bd.inner_nblks > 1 || (bd.inner_nblks == 1 && bd.inner_idxs[0] != axis))
+        return status::unimplemented;
+    for (int d = 0; d < ndims; ++d)
+        if (d != axis && data_d.padded_dims()[d] != dims[d])
+            return status::unimplemented;
+
+    /* the inner dimensions have to collapse into a single one */
+    jsp.inner_stride = 1;
+    int last_d = -1;
+    for (int d = ndims - 1; d > axis; --d) {
+        if (dims[d] == 1) continue;
+        if (last_d == -1)
+            jsp.inner_stride = bd.strides[d];
+        else if (bd.strides[d] != bd.strides[last_d] * dims[last_d])
+            return status::unimplemented;
+        last_d = d;
+    }
+
+    const int simd_w = jsp.simd_w;
+    const dim_t axis_blk = bd.inner_nblks == 1 ? bd.inner_blks[0] : 1;
+
+    if (bd.inner_nblks == 0 && jsp.inner_size > 1 && jsp.inner_stride == 1) {
+        jsp.axis_is_vec = false;
+        jsp.inner_chunk = simd_w;
+        jsp.axis_stride = bd.strides[axis];
+        jsp.nb_blk = jsp.blk_nvec = jsp.blk_stride = 0;
+        jsp.axis_tail = jsp.tail_off = 0;
+    } else if (bd.inner_nblks == 0 && bd.strides[axis] == 1) {
+        jsp.axis_is_vec = true;
+        jsp.inner_chunk = 1;
+        jsp.nb_blk = 1;
+        jsp.blk_nvec = jsp.axis_size / simd_w;
+        jsp.blk_stride = jsp.blk_nvec * simd_w;
+        jsp.axis_tail = jsp.axis_size % simd_w;
+        jsp.tail_off = jsp.blk_stride;
+        jsp.axis_stride = 1;
+    } else if (bd.inner_nblks == 1 && axis_blk % simd_w == 0) {
+        jsp.axis_is_vec = true;
+        jsp.inner_chunk = 1;
+        jsp.nb_blk = jsp.axis_size / axis_blk;
+        jsp.blk_nvec = axis_blk / simd_w;
+        jsp.blk_stride = bd.strides[axis];
+        jsp.axis_tail = jsp.axis_size % axis_blk;
+        jsp.tail_off = jsp.nb_blk * jsp.blk_stride;
+        jsp.axis_stride = 1;
+    } else {
+        return status::unimplemented;
+    }
+
+    /* all the offsets within a point are encoded as 32-bit immediates */
+    const dim_t max_off = nstl::max(nstl::max(jsp.inner_stride,
+                jsp.axis_stride * jsp.axis_size),
+            nstl::max(jsp.nb_blk * jsp.blk_stride, jsp.tail_off
+                + jsp.axis_tail));
+    if (max_off >= INT_MAX / (dim_t)sizeof(float))
+        return status::unimplemented;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::load(const Vmm &v, const Address &a,
+        bool tail) {
+    if (!tail)
+        uni_vmovups(v, a);
+    else if (isa == sse41)
+        movss(Xmm(v.getIdx()), a);
+    else
+        vmovss(Xmm(v.getIdx()), a);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::store(const Address &a, const Vmm &v,
+        bool tail) {
+    if (!tail)
+        uni_vmovups(a, v);
+    else if (isa == sse41)
+        movss(a, Xmm(v.getIdx()));
+    else
+        vmovss(a, Xmm(v.getIdx()));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::uni_broadcast(const Vmm &v, float val) {
+    uni_broadcast_bits(v, float2int(val));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::uni_broadcast_bits(const Vmm &v,
+        uint32_t bits) {
+    mov(reg_tmp.cvt32(), bits);
+    if (isa == sse41)
+        movd(xmm_tmp, reg_tmp.cvt32());
+    else
+        vmovd(xmm_tmp, reg_tmp.cvt32());
+    uni_vbroadcastss(v, xmm_tmp);
+}
+
+/* v = log(v) for positive normal v (the sum of exponents is at least 1):
+ * v = 2^e * m with m in [1, 2), log(m) = 2 * atanh(s) with s = (m - 1) / (m + 1)
+ * in [0, 1/3), and the atanh series up to s^13 is accurate to float precision.
+ * Clobbers vmm_x, vmm_tmp, vmm_diff_dst and vmm_aux. */
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::log_vector(const Vmm &v) {
+    const Vmm &vmm_e = vmm_x, &vmm_c = vmm_diff_dst, &vmm_z = vmm_aux;
+
+    /* the exponent */
+    uni_vmovups(vmm_e, v);
+    uni_vpsrld(vmm_e, vmm_e, 23);
+    uni_vcvtdq2ps(vmm_e, vmm_e);
+    uni_broadcast(vmm_c, 127.f);
+    uni_vsubps(vmm_e, vmm_e, vmm_c);
+
+    /* the mantissa */
+    uni_broadcast_bits(vmm_c, 0x007fffff);
+    uni_vandps(v, v, vmm_c);
+    uni_broadcast(vmm_c, 1.f);
+    uni_vorps(v, v, vmm_c);
+
+    /* s = (m - 1) / (m + 1), z = s^2 */
+    uni_vmovups(vmm_z, v);
+    uni_vaddps(vmm_z, vmm_z, vmm_c);
+    uni_vsubps(v, v, vmm_c);
+    uni_vdivps(v, v, vmm_z);
+    uni_vmovups(vmm_z, v);
+    uni_vmulps(vmm_z, vmm_z, v);
+
+    /* atanh(s) / s = 1 + z / 3 + z^2 / 5 + ... + z^6 / 13 */
+    uni_broadcast(vmm_c, 1.f / 13);
+    for (int k = 11; k > 0; k -= 2) {
+        uni_broadcast(vmm_tmp, 1.f / k);
+        uni_vfmadd213ps(vmm_c, vmm_z, vmm_tmp);
+    }
+    uni_vmulps(v, v, vmm_c);
+    uni_vaddps(v, v, v);
+
+    /* + e * log(2) */
+    uni_broadcast(vmm_tmp, 0.693147181f);
+    uni_vmulps(vmm_e, vmm_e, vmm_tmp);
+    uni_vaddps(v, v, vmm_e);
+}
+
+/* leaves the result of the reduction in all the lanes of acc */
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::reduce(const Vmm &acc, reduce_t kind) {
+    auto op = [&]() {
+        if (kind == reduce_max)
+            uni_vmaxps(acc, acc, vmm_tmp);
+        else
+            uni_vaddps(acc, acc, vmm_tmp);
+    };
+
+    if (isa == avx512_common) {
+        vshuff32x4(Zmm(vmm_tmp.getIdx()), Zmm(acc.getIdx()),
+                Zmm(acc.getIdx()), 0x4E);
+        op();
+        vshuff32x4(Zmm(vmm_tmp.getIdx()), Zmm(acc.getIdx()),
+                Zmm(acc.getIdx()), 0xB1);
+        op();
+    } else if (isa == avx2) {
+        vperm2f128(Ymm(vmm_tmp.getIdx()), Ymm(acc.getIdx()),
+                Ymm(acc.getIdx()), 0x1);
+        op();
+    }
+
+    for (int imm: {0x4E, 0xB1}) {
+        if (isa == sse41) {
+            movups(vmm_tmp, acc);
+            shufps(vmm_tmp, vmm_tmp, imm);
+        } else {
+            vshufps(vmm_tmp, acc, acc, imm);
+        }
+        op();
+    }
+}
+
+/* Applies body along the axis. When the axis is reduced within registers
+ * (axis_is_vec) the vector part is followed by the reduction of acc, the
+ * scalar tail is accumulated to the first lane, and the result is broadcast
+ * back to all the lanes. Otherwise each lane handles its own point and tail
+ * denotes a single point to process. */
+template <cpu_isa_t isa>
+template <typename body_t>
+void jit_uni_softmax_kernel_f32<isa>::axis_loop(body_t body, const Vmm &acc,
+        reduce_t kind, bool tail) {
+    const int f32_size = sizeof(float);
+
+    if (!jsp.axis_is_vec) {
+        Label axis_loop_label;
+        xor_(reg_off, reg_off);
+        mov(reg_cnt, jsp.axis_size);
+        L(axis_loop_label); {
+            body(tail, 0);
+            add(reg_off, jsp.axis_stride * f32_size);
+            dec(reg_cnt);
+            jnz(axis_loop_label, T_NEAR);
+        }
+        return;
+    }
+
+    if (jsp.nb_blk * jsp.blk_nvec > 0) {
+        Label blk_loop_label, vec_loop_label;
+        xor_(reg_blk_off, reg_blk_off);
+        L(blk_loop_label); {
+            mov(reg_off, reg_blk_off);
+            mov(reg_cnt, jsp.blk_nvec);
+            L(vec_loop_label); {
+                body(false, 0);
+                add(reg_off, vlen);
+                dec(reg_cnt);
+                jnz(vec_loop_label, T_NEAR);
+            }
+            add(reg_blk_off, jsp.blk_stride * f32_size);
+            cmp(reg_blk_off, jsp.nb_blk * jsp.blk_stride * f32_size);
+            jl(blk_loop_label, T_NEAR);
+        }
+    }
+
+    if (kind != reduce_none)
+        reduce(acc, kind);
+
+    if (jsp.axis_tail > 0) {
+        xor_(reg_off, reg_off);
+        for (dim_t i = 0; i < jsp.axis_tail; ++i)
+            body(true, (int)((jsp.tail_off + i) * f32_size));
+        if (kind != reduce_none)
+            uni_vbroadcastss(acc, Xmm(acc.getIdx()));
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::compute_fwd(bool tail) {
+    uni_broadcast(vmm_max, -FLT_MAX);
+    axis_loop([&](bool t, int disp) {
+        load(vmm_x, addr(reg_src, disp), t);
+        uni_vmaxps(vmm_max, vmm_max, vmm_x);
+    }, vmm_max, reduce_max, tail);
+
+    const bool is_log = jsp.is_logsoftmax;
+
+    uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+    axis_loop([&](bool t, int disp) {
+        load(vmm_x, addr(reg_src, disp), t);
+        uni_vsubps(vmm_x, vmm_x, vmm_max);
+        eltwise_injector_->compute_vector(vmm_x.getIdx());
+        /* logsoftmax does not keep the exponents */
+        if (!is_log)
+            store(addr(reg_dst, disp), vmm_x, t);
+        uni_vaddps(vmm_sum, vmm_sum, vmm_x);
+    }, vmm_sum, reduce_sum, tail);
+
+    if (is_log) {
+        /* dst = src - (max + log(sum)) */
+        log_vector(vmm_sum);
+        uni_vaddps(vmm_max, vmm_max, vmm_sum);
+        axis_loop([&](bool t, int disp) {
+            load(vmm_x, addr(reg_src, disp), t);
+            uni_vsubps(vmm_x, vmm_x, vmm_max);
+            store(addr(reg_dst, disp), vmm_x, t);
+        }, vmm_max, reduce_none, tail);
+        return;
+    }
+
+    uni_broadcast(vmm_tmp, 1.f);
+    uni_vdivps(vmm_tmp, vmm_tmp, vmm_sum);
+    uni_vmovups(vmm_sum, vmm_tmp);
+    axis_loop([&](bool t, int disp) {
+        load(vmm_x, addr(reg_dst, disp), t);
+        uni_vmulps(vmm_x, vmm_x, vmm_sum);
+        store(addr(reg_dst, disp), vmm_x, t);
+    }, vmm_sum, reduce_none, tail);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::compute_bwd(bool tail) {
+    if (jsp.is_logsoftmax) {
+        /* diff_src = diff_dst - exp(dst) * sum(diff_dst) */
+        uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+        axis_loop([&](bool t, int disp) {
+            load(vmm_diff_dst, addr(reg_diff_dst, disp), t);
+            uni_vaddps(vmm_sum, vmm_sum, vmm_diff_dst);
+        }, vmm_sum, reduce_sum, tail);
+
+        axis_loop([&](bool t, int disp) {
+            load(vmm_x, addr(reg_dst, disp), t);
+            eltwise_injector_->compute_vector(vmm_x.getIdx());
+            uni_vmulps(vmm_x, vmm_x, vmm_sum);
+            load(vmm_diff_dst, addr(reg_diff_dst, disp), t);
+            uni_vsubps(vmm_diff_dst, vmm_diff_dst, vmm_x);
+            store(addr(reg_diff_src, disp), vmm_diff_dst, t);
+        }, vmm_sum, reduce_none, tail);
+        return;
+    }
+
+    uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+    axis_loop([&](bool t, int disp) {
+        load(vmm_x, addr(reg_dst, disp), t);
+        load(vmm_diff_dst, addr(reg_diff_dst, disp), t);
+        uni_vmulps(vmm_x, vmm_x, vmm_diff_dst);
+        uni_vaddps(vmm_sum, vmm_sum, vmm_x);
+    }, vmm_sum, reduce_sum, tail);
+
+    axis_loop([&](bool t, int disp) {
+        load(vmm_diff_dst, addr(reg_diff_dst, disp), t);
+        uni_vsubps(vmm_diff_dst, vmm_diff_dst, vmm_sum);
+        load(vmm_x, addr(reg_dst, disp), t);
+        uni_vmulps(vmm_x, vmm_x, vmm_diff_dst);
+        store(addr(reg_diff_src, disp), vmm_x, t);
+    }, vmm_sum, reduce_none, tail);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::shift_points(int shift) {
+    if (jsp.is_fwd) {
+        add(reg_src, shift);
+        add(reg_dst, shift);
+    } else {
+        add(reg_dst, shift);
+        add(reg_diff_dst, shift);
+        add(reg_diff_src, shift);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::generate() {
+    preamble();
+
+    if (jsp.is_fwd) {
+        mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    } else {
+        mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+        mov(reg_diff_dst, ptr[reg_param + GET_OFF(diff_dst)]);
+        mov(reg_diff_src, ptr[reg_param + GET_OFF(diff_src)]);
+    }
+    mov(reg_work_amount, ptr[reg_param + GET_OFF(work_amount)]);
+
+    if (use_exp())
+        eltwise_injector_->load_table_addr();
+
+    auto compute = [&](bool tail) {
+        if (jsp.is_fwd)
+            compute_fwd(tail);
+        else
+            compute_bwd(tail);
+    };
+
+    if (jsp.axis_is_vec) {
+        Label point_loop_label;
+        L(point_loop_label); {
+            compute(false);
+            shift_points(jsp.inner_stride * sizeof(float));
+            dec(reg_work_amount);
+            jnz(point_loop_label, T_NEAR);
+        }
+    } else {
+        Label vec_loop_label, vec_loop_end_label;
+        Label tail_loop_label, tail_loop_end_label;
+
+        L(vec_loop_label); {
+            cmp(reg_work_amount, jsp.simd_w);
+            jl(vec_loop_end_label, T_NEAR);
+            compute(false);
+            shift_points(vlen);
+            sub(reg_work_amount, jsp.simd_w);
+            jmp(vec_loop_label, T_NEAR);
+        }
+        L(vec_loop_end_label);
+
+        L(tail_loop_label); {
+            cmp(reg_work_amount, 0);
+            jle(tail_loop_end_label, T_NEAR);
+            compute(true);
+            shift_points(sizeof(float));
+            dec(reg_work_amount);
+            jmp(tail_loop_label, T_NEAR);
+        }
+        L(tail_loop_end_label);
+    }
+
+    postamble();
+
+    if (use_exp())
+        eltwise_injector_->prepare_table();
+}
+
+template struct jit_uni_softmax_kernel_f32<sse41>;
+template struct jit_uni_softmax_kernel_f32<avx2>;
+template struct jit_uni_softmax_kernel_f32<avx512_common>;
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_UNI_SOFTMAX_KERNEL_F32_HPP
+#define JIT_UNI_SOFTMAX_KERNEL_F32_HPP
+
+#include "c_types_map.hpp"
+#include "softmax_pd.hpp"
+#include "type_helpers.hpp"
+
+#include "jit_generator.hpp"
+#include "jit_primitive_conf.hpp"
+#include "jit_uni_eltwise.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+template <cpu_isa_t isa>
+struct jit_uni_softmax_kernel_f32: public jit_generator {
+    jit_uni_softmax_kernel_f32(jit_softmax_conf_t ajsp)
+        : jsp(ajsp), eltwise_injector_(nullptr)
+    {
+        if (use_exp())
+            eltwise_injector_ = new jit_uni_eltwise_injector_f32<isa>(this,
+                    alg_kind::eltwise_exp, 0.f, 0.f, false, reg_table);
+
+        this->generate();
+        jit_ker = (decltype(jit_ker))this->getCode();
+    }
+
+    ~jit_uni_softmax_kernel_f32() { delete eltwise_injector_; }
+
+    jit_softmax_conf_t jsp;
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_softmax_kernel_f32)
+
+    void operator()(jit_softmax_call_s *arg) { jit_ker(arg); }
+    static status_t init_conf(jit_softmax_conf_t &jsp,
+            const softmax_pd_t *spd);
+
+private:
+    using Vmm = typename utils::conditional3<isa == sse41, Xbyak::Xmm,
+            isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    enum reduce_t { reduce_none, reduce_max, reduce_sum };
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_param = abi_param1;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_diff_dst = r10;
+    Xbyak::Reg64 reg_diff_src = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_off = r13;
+    Xbyak::Reg64 reg_blk_off = r14;
+    Xbyak::Reg64 reg_cnt = r15;
+    Xbyak::Reg64 reg_table = rbx;
+    Xbyak::Reg64 reg_tmp = rbp;
+
+    /* Vmm(0) and Vmm(1) are clobbered by the exp injector */
+    Vmm vmm_x = Vmm(4);
+    Vmm vmm_max = Vmm(5);
+    Vmm vmm_sum = Vmm(6);
+    Vmm vmm_tmp = Vmm(7);
+    Vmm vmm_diff_dst = Vmm(8);
+
+    Vmm vmm_aux = Vmm(9);
+    Xbyak::Xmm xmm_tmp = Xbyak::Xmm(7);
+
+    jit_uni_eltwise_injector_f32<isa> *eltwise_injector_;
+
+    /* softmax forward computes exp(x - max), logsoftmax backward exp(dst) */
+    bool use_exp() const { return jsp.is_fwd || jsp.is_logsoftmax; }
+
+    void (*jit_ker)(jit_softmax_call_s *);
+
+    Xbyak::Address addr(const Xbyak::Reg64 &base, int disp)
+    { return ptr[base + reg_off + disp]; }
+
+    void load(const Vmm &v, const Xbyak::Address &a, bool tail);
+    void store(const Xbyak::Address &a, const Vmm &v, bool tail);
+    void uni_broadcast(const Vmm &v, float val);
+    void uni_broadcast_bits(const Vmm &v, uint32_t bits);
+    void log_vector(const Vmm &v);
+    void reduce(const Vmm &acc, reduce_t kind);
+
+    template <typename body_t>
+    void axis_loop(body_t body, const Vmm &acc, reduce_t kind, bool tail);
+
+    void compute_fwd(bool tail);
+    void compute_bwd(bool tail);
+    void shift_points(int shift);
+
+    void generate();
+};
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
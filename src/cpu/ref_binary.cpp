@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "math_utils.hpp"
+#include "mkldnn_thread.hpp"
+#include "type_helpers.hpp"
+
+#include "ref_binary.hpp"
+#include "simple_q10n.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+namespace {
+float compute_binary_scalar(alg_kind_t alg, float x, float y) {
+    using namespace alg_kind;
+    switch (alg) {
+    case binary_add: return x + y;
+    case binary_mul: return x * y;
+    case binary_max: return nstl::max(x, y);
+    case binary_min: return nstl::min(x, y);
+    default: assert(!"unknown binary alg_kind");
+    }
+    return 0.f;
+}
+}
+
+template <data_type_t src0_type, data_type_t src1_type, data_type_t dst_type>
+void ref_binary_t<src0_type, src1_type, dst_type>::execute_ref(
+        const exec_ctx_t &ctx) const {
+    auto src0 = CTX_IN_MEM(const src0_data_t *, MKLDNN_ARG_SRC_0);
+    auto src1 = CTX_IN_MEM(const src1_data_t *, MKLDNN_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(dst_data_t *, MKLDNN_ARG_DST);
+
+    const memory_desc_wrapper src0_d(pd()->src_md(0));
+    const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const int ndims = pd()->ndims();
+    const dims_t &dims = dst_d.dims();
+    const alg_kind_t alg = pd()->alg_kind();
+
+    parallel_nd(dst_d.nelems(), [&](dim_t l) {
+        dims_t pos;
+        dim_t rem = l;
+        for (int d = ndims - 1; d >= 0; --d) {
+            pos[d] = rem % dims[d];
+            rem /= dims[d];
+        }
+        const float x = src0[src0_d.off_v(pos)];
+
+        for (int d = 0; d < ndims; ++d)
+            if (pd()->is_broadcast_dim(d)) pos[d] = 0;
+        const float y = src1[src1_d.off_v(pos)];
+
+        float res = compute_binary_scalar(alg, x, y);
+        for (auto e: eltwise_ker_)
+            res = e->compute_scalar(res);
+
+        dst[dst_d.off_l(l)] = qz_a1b0<float, dst_data_t>()(res);
+    });
+}
+
+using namespace data_type;
+
+template struct ref_binary_t<f32>;
+template struct ref_binary_t<bf16>;
+template struct ref_binary_t<s8>;
+template struct ref_binary_t<u8>;
+template struct ref_binary_t<s8, u8, s8>;
+template struct ref_binary_t<u8, s8, u8>;
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_BINARY_HPP
+#define CPU_REF_BINARY_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_binary_pd.hpp"
+#include "cpu_isa_traits.hpp"
+#include "cpu_primitive.hpp"
+#include "ref_eltwise.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+template <impl::data_type_t src0_type,
+         impl::data_type_t src1_type = src0_type,
+         impl::data_type_t dst_type = src0_type>
+struct ref_binary_t: public cpu_primitive_t {
+    struct pd_t: public cpu_binary_pd_t {
+        using cpu_binary_pd_t::cpu_binary_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_binary_t);
+
+        status_t init() {
+            using namespace data_type;
+
+            bool ok = true
+                && src_md(0)->data_type == src0_type
+                && src_md(1)->data_type == src1_type
+                && dst_md()->data_type == dst_type
+                /*bf16<->f32 cvt operators don't work on non-avx512_core*/
+                && IMPLICATION(utils::one_of(bf16, src0_type, src1_type,
+                            dst_type), mayiuse(avx512_core))
+                && set_default_params() == status::success
+                && attr()->output_scales_.has_default_values()
+                && post_ops_ok();
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        }
+
+    private:
+        bool post_ops_ok() const {
+            const auto &p = attr()->post_ops_;
+            for (int i = 0; i < p.len_; ++i)
+                if (!p.entry_[i].is_eltwise()) return false;
+            return true;
+        }
+    };
+
+    ref_binary_t(const pd_t *apd): cpu_primitive_t(apd) {
+        const auto &p = pd()->attr()->post_ops_;
+        for (int i = 0; i < p.len_; ++i)
+            eltwise_ker_.push_back(
+                    new ref_eltwise_scalar_fwd_t(p.entry_[i].eltwise));
+    }
+
+    ~ref_binary_t() {
+        for (auto e: eltwise_ker_) delete e;
+    }
+
+    typedef typename prec_traits<src0_type>::type src0_data_t;
+    typedef typename prec_traits<src1_type>::type src1_data_t;
+    typedef typename prec_traits<dst_type>::type dst_data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_ref(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_ref(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd(); }
+
+    std::vector<ref_eltwise_scalar_fwd_t *> eltwise_ker_;
+};
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -34,7 +34,8 @@ ref_eltwise_scalar_fwd_t::ref_eltwise_scalar_fwd_t(alg_kind_t alg, float alpha,
         float beta): alg_(alg), alpha_(alpha), beta_(beta) {
     assert(utils::one_of(alg_, eltwise_relu, eltwise_tanh, eltwise_elu,
                 eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_linear,
-                eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic));
+                eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic,
+                eltwise_exp));
 }
 
 ref_eltwise_scalar_fwd_t::ref_eltwise_scalar_fwd_t(
@@ -53,6 +54,7 @@ float ref_eltwise_scalar_fwd_t::compute_scalar(float s) {
         case eltwise_bounded_relu: return bounded_relu_fwd(s, alpha_);
         case eltwise_soft_relu: return soft_relu_fwd(s);
         case eltwise_logistic: return logistic_fwd(s);
+        case eltwise_exp: return exp_fwd(s);
         default: assert(!"unknown eltwise alg_kind");
     }
 
@@ -85,6 +87,7 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_nCspBc_padded(
                 d = bounded_relu_fwd(s, alpha); break;
             case eltwise_soft_relu: d = soft_relu_fwd(s); break;
             case eltwise_logistic: d = logistic_fwd(s); break;
+            case eltwise_exp: d = exp_fwd(s); break;
             default: assert(!"unknown eltwise alg_kind");
         }
     };
@@ -143,6 +146,7 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_generic(
                 d = bounded_relu_fwd(s, alpha); break;
             case eltwise_soft_relu: d = soft_relu_fwd(s); break;
             case eltwise_logistic: d = logistic_fwd(s); break;
+            case eltwise_exp: d = exp_fwd(s); break;
             default: assert(!"unknown eltwise alg_kind");
         }
     });
@@ -186,6 +190,7 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_dense(
         case eltwise_bounded_relu: d = bounded_relu_fwd(s, alpha); break;
         case eltwise_soft_relu: d = soft_relu_fwd(s); break;
         case eltwise_logistic: d = logistic_fwd(s); break;
+        case eltwise_exp: d = exp_fwd(s); break;
         default: assert(!"unknown eltwise alg_kind");
         }
     });
@@ -237,6 +242,7 @@ void ref_eltwise_bwd_t<data_type>::execute_backward_generic(
                 ds = bounded_relu_bwd(dd, s, alpha); break;
             case eltwise_soft_relu: ds = soft_relu_bwd(dd, s); break;
             case eltwise_logistic: ds = logistic_bwd(dd, s); break;
+            case eltwise_exp: ds = exp_bwd(dd, s); break;
             default: assert(!"unknown eltwise alg_kind");
         }
     });
@@ -277,6 +283,7 @@ void ref_eltwise_bwd_t<data_type>::execute_backward_dense(
         case eltwise_bounded_relu: ds = bounded_relu_bwd(dd, s, alpha); break;
         case eltwise_soft_relu: ds = soft_relu_bwd(dd, s); break;
         case eltwise_logistic: ds = logistic_bwd(dd, s); break;
+        case eltwise_exp: ds = exp_bwd(dd, s); break;
         default: assert(!"unknown eltwise alg_kind");
         }
     });
@@ -52,9 +52,18 @@ void ref_softmax_fwd_t<data_type>::execute_forward_dense(
 
         _max(channels_, src_data, &scalar);
         _sub(channels_, scalar, src_data, dst_data);
-        _exp(channels_, dst_data, dst_data);
-        _sum(channels_, dst_data, &scalar);
-        _scal(channels_, data_t(1)/scalar, dst_data);
+        if (pd()->is_logsoftmax()) {
+            /* dst keeps src - max, the exponents are only summed up */
+            data_t sum = 0;
+            PRAGMA_OMP_SIMD(reduction(+ : sum))
+            for (int c = 0; c < channels_; ++c)
+                sum += expf(dst_data[c]);
+            _sub(channels_, logf(sum), dst_data, dst_data);
+        } else {
+            _exp(channels_, dst_data, dst_data);
+            _sum(channels_, dst_data, &scalar);
+            _scal(channels_, data_t(1)/scalar, dst_data);
+        }
     });
 }
 
@@ -86,17 +95,33 @@ void ref_softmax_fwd_t<data_type>::execute_forward_generic(
             }
         }
 
+        const bool is_log = pd()->is_logsoftmax();
+
         for (int c = 0; c < channels_; c++) {
             for(int in = 0; in < inner_size_; in++) {
                 size_t off = data_d.off_l(ou * dim + c * inner_size_ + in);
-                space_denom[in] += dst[off] = exp(src[off] - space_max[in]);
+                data_t d = src[off] - space_max[in];
+                if (is_log) {
+                    dst[off] = d;
+                    space_denom[in] += exp(d);
+                } else {
+                    space_denom[in] += dst[off] = exp(d);
+                }
             }
         }
 
+        if (is_log) {
+            for (int in = 0; in < inner_size_; in++)
+                space_denom[in] = log(space_denom[in]);
+        }
+
         for (int c = 0; c < channels_; c++) {
             for (int in = 0; in < inner_size_; in++) {
                 size_t off = data_d.off_l(ou * dim + c * inner_size_ + in);
-                dst[off] /= space_denom[in];
+                if (is_log)
+                    dst[off] -= space_denom[in];
+                else
+                    dst[off] /= space_denom[in];
             }
         }
     }
@@ -225,9 +250,23 @@ void ref_softmax_bwd_t<data_type>::execute_backward_dense(
     const size_t ou_stride = axis > 0
         ? diff_d.blocking_desc().strides[axis - 1] : 1u;
 
+    const bool is_log = pd()->is_logsoftmax();
+
     parallel_nd(outer_size_, [&](int ou) {
         data_t sbr = 0;
         size_t off = ou * ou_stride;
+        if (is_log) {
+            /* diff_src = diff_dst - exp(dst) * sum(diff_dst) */
+            for (int c = 0; c < channels_; ++c)
+                sbr += diff_dst[off + c];
+
+            for (int c = 0; c < channels_; ++c) {
+                size_t loff = off + c;
+                diff_src[loff] = diff_dst[loff] - expf(dst[loff]) * sbr;
+            }
+            return;
+        }
+
         for (int c = 0; c < channels_; ++c) {
             size_t loff = off + c;
             data_t ldata = dst[loff];
@@ -253,6 +292,7 @@ void ref_softmax_bwd_t<data_type>::execute_backward_generic(
     const memory_desc_wrapper data_d(pd()->dst_md());
 
     const size_t dim = channels_ * inner_size_;
+    const bool is_log = pd()->is_logsoftmax();
 
     parallel_nd(outer_size_, [&](int ou) {
         for (int in = 0; in < inner_size_; in++) {
@@ -260,13 +300,16 @@ void ref_softmax_bwd_t<data_type>::execute_backward_generic(
             for (int c = 0; c < channels_; c++) {
                 size_t off_diff = diff_d.off_l(ou * dim + c * inner_size_ + in);
                 size_t off_data = data_d.off_l(ou * dim + c * inner_size_ + in);
-                sbr += diff_dst[off_diff] * dst[off_data];
+                sbr += is_log
+                    ? diff_dst[off_diff] : diff_dst[off_diff] * dst[off_data];
             }
 
             for(int c=0; c < channels_ ; ++c) {
               size_t off_diff = diff_d.off_l(ou * dim + c * inner_size_ + in);
               size_t off_data = data_d.off_l(ou * dim + c * inner_size_ + in);
-              diff_src[off_diff] = dst[off_data] * (diff_dst[off_diff] - sbr);
+              diff_src[off_diff] = is_log
+                  ? diff_dst[off_diff] - exp(dst[off_data]) * sbr
+                  : dst[off_data] * (diff_dst[off_diff] - sbr);
             }
         }
     });
@@ -44,7 +44,7 @@ template <prop_kind_t aprop, impl::data_type_t src_type,
 struct _ref_rnn_common_t : public cpu_primitive_t {
     typedef typename prec_traits<src_type>::type src_data_t;
     typedef typename prec_traits<weights_type>::type weights_data_t;
-    typedef typename utils::conditional<src_type == data_type::u8, int32_t,
+    typedef typename utils::conditional<src_type == mkldnn_u8, int32_t,
             float>::type acc_data_t;
 
     using class_name = _ref_rnn_common_t<aprop, src_type, weights_type>;
@@ -164,7 +164,7 @@ struct _ref_rnn_common_t : public cpu_primitive_t {
     };
 
     _ref_rnn_common_t(const pd_t *apd)
-        : cpu_primitive_t(apd, true), rnn_postgemm_(nullptr) {
+        : cpu_primitive_t(apd), rnn_postgemm_(nullptr) {
         /// @todo set max_feature_size assuming that we limit the number of
         /// iterations and layer to one if slc != dic and sic != dic
         /// respectively
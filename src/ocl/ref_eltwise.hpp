@@ -52,7 +52,8 @@ struct ref_eltwise_fwd_t : public primitive_t {
                                alg_kind::eltwise_square,
                                alg_kind::eltwise_sqrt,
                                alg_kind::eltwise_soft_relu,
-                               alg_kind::eltwise_logistic)
+                               alg_kind::eltwise_logistic,
+                               alg_kind::eltwise_exp)
                     && utils::one_of(desc()->data_desc.data_type,
                                data_type::f32, data_type::f16)
                     && attr()->has_default_values()
@@ -127,7 +128,8 @@ struct ref_eltwise_bwd_t : public primitive_t {
                                alg_kind::eltwise_square,
                                alg_kind::eltwise_sqrt,
                                alg_kind::eltwise_soft_relu,
-                               alg_kind::eltwise_logistic)
+                               alg_kind::eltwise_logistic,
+                               alg_kind::eltwise_exp)
                     && desc()->data_desc.data_type == data_type::f32
                     && data_mdw == diff_data_mdw
                     && attr()->has_default_values();
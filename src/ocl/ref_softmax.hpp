@@ -47,6 +47,7 @@ struct ref_softmax_fwd_t : public primitive_t {
                     && utils::one_of(desc()->prop_kind,
                                prop_kind::forward_inference,
                                prop_kind::forward_training)
+                    && !is_logsoftmax()
                     && data_type == desc()->data_desc.data_type
                     && IMPLICATION(data_type == data_type::f16,
                             ocl_engine->mayiuse(cl_device_ext_t::khr_fp16))
@@ -116,6 +117,7 @@ struct ref_softmax_bwd_t : public primitive_t {
             bool ok = true
                 && desc()->prop_kind == prop_kind::backward_data
                 && desc()->data_desc.data_type == data_type::f32
+                && !is_logsoftmax()
                 && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
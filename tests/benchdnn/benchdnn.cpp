@@ -36,6 +36,7 @@
 #include "bnorm/bnorm.hpp"
 #include "rnn/rnn.hpp"
 #include "softmax/softmax.hpp"
+#include "binary/binary.hpp"
 #include "pool/pool.hpp"
 
 int verbose {0};
@@ -64,6 +65,7 @@ int main(int argc, char **argv) {
         else if (!strcmp("--rnn", argv[0])) prim = RNN;
         else if (!strcmp("--softmax", argv[0])) prim = SOFTMAX;
         else if (!strcmp("--pool", argv[0])) prim = POOL;
+        else if (!strcmp("--binary", argv[0])) prim = BINARY;
         else break;
     }
 
@@ -81,6 +83,7 @@ int main(int argc, char **argv) {
     case RNN: rnn::bench(argc, argv); break;
     case SOFTMAX: softmax::bench(argc, argv); break;
     case POOL: pool::bench(argc, argv); break;
+    case BINARY: binary::bench(argc, argv); break;
     default: fprintf(stderr, "err: unknown driver\n");
     }
 
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "mkldnn.h"
+
+#include "mkldnn_common.hpp"
+#include "mkldnn_memory.hpp"
+#include "parser.hpp"
+
+#include "binary/binary.hpp"
+
+namespace binary {
+
+std::vector<alg_t> alg {ADD};
+std::vector<std::vector<mkldnn_data_type_t>> sdt {{mkldnn_f32, mkldnn_f32}};
+std::vector<mkldnn_data_type_t> ddt {mkldnn_f32};
+std::vector<std::vector<mkldnn_format_tag_t>> stag {{mkldnn_nchw,
+    mkldnn_nchw}};
+attr_t attr;
+const char *skip_impl = "";
+bool allow_unimpl = false;
+const char *perf_template_csv =
+    "perf,%engine%,%alg%,%dt%,%tag%,%attr%,%DESC%,%-time%,%0time%";
+const char *perf_template_def = "perf,%engine%,%desc%,%-time%,%0time%";
+const char *perf_template = perf_template_def;
+
+void reset_parameters() {
+    alg = {ADD};
+    sdt = {{mkldnn_f32, mkldnn_f32}};
+    ddt = {mkldnn_f32};
+    stag = {{mkldnn_nchw, mkldnn_nchw}};
+    attr = attr_t();
+    skip_impl = "";
+    allow_unimpl = false;
+}
+
+void check_correctness(const desc_t *c) {
+    for (const auto &i_alg: alg)
+    for (const auto &i_sdt: sdt)
+    for (const auto &i_ddt: ddt)
+    for (const auto &i_stag: stag) {
+        const prb_t p(*c, i_alg, i_sdt, i_ddt, i_stag, attr);
+        char pstr[max_prb_len];
+        prb2str(&p, pstr);
+
+        res_t res{};
+        const int status = doit(&p, &res);
+
+        bool want_perf_report = false;
+        parse_result(res, want_perf_report, allow_unimpl, status, pstr);
+
+        if (want_perf_report && bench_mode & PERF) {
+            perf_report_t pr(perf_template);
+            pr.report(&p, &res, pstr);
+        }
+
+        benchdnn_stat.tests++;
+    }
+}
+
+int bench(int argc, char **argv) {
+    using namespace parser;
+    for (; argc > 0; --argc, ++argv) {
+        if (parse_bench_settings(argv[0]));
+        else if (parse_batch(bench, argv[0]));
+        else if (parse_vector_option(alg, str2alg, argv[0], "alg"));
+        else if (parse_vector_option(sdt, str2sdt, argv[0], "sdt"));
+        else if (parse_dt(ddt, argv[0], "ddt"));
+        else if (parse_vector_option(stag, str2stag, argv[0], "stag"));
+        else if (parse_attr(attr, argv[0]));
+        else if (parse_skip_impl(skip_impl, argv[0]));
+        else if (parse_allow_unimpl(allow_unimpl, argv[0]));
+        else if (parse_perf_template(perf_template, perf_template_def,
+                    perf_template_csv, argv[0]));
+        else if (parse_reset(reset_parameters, argv[0]));
+        else {
+            catch_unknown_options(argv[0], "binary");
+
+            desc_t c;
+            SAFE(str2desc(&c, argv[0]), CRIT);
+            check_correctness(&c);
+        }
+    }
+
+    return OK;
+}
+}
@@ -0,0 +1,202 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+
+#include "mkldnn.h"
+
+#include "src/common/mkldnn_thread.hpp"
+
+#include "mkldnn_common.hpp"
+#include "mkldnn_memory.hpp"
+
+#include "binary/binary.hpp"
+
+namespace binary {
+
+static int init_pd(const prb_t *p, mkldnn_binary_desc_t &bd,
+        mkldnn_primitive_desc_t &bpd, res_t *r) {
+    mkldnn_memory_desc_t src_d[2], dst_d;
+    const int ndims = p->ndims();
+
+    for (int i = 0; i < 2; ++i) {
+        mkldnn_dims_t dims;
+        for (int d = 0; d < ndims; ++d)
+            dims[d] = p->dims[i][d];
+        DNN_SAFE(mkldnn_memory_desc_init_by_tag(&src_d[i], ndims, dims,
+                    p->sdt[i], p->stag[i]), WARN);
+    }
+
+    mkldnn_dims_t dst_dims;
+    for (int d = 0; d < ndims; ++d)
+        dst_dims[d] = p->dims[0][d];
+    DNN_SAFE(mkldnn_memory_desc_init_by_tag(&dst_d, ndims, dst_dims, p->ddt,
+                mkldnn_format_tag_any), WARN);
+
+    DNN_SAFE(mkldnn_binary_desc_init(&bd, alg2alg_kind(p->alg), &src_d[0],
+                &src_d[1], &dst_d), WARN);
+
+    auto mkldnn_attr = create_mkldnn_attr(p->attr, 1, NULL);
+
+    mkldnn_status_t init_status = mkldnn_primitive_desc_create(&bpd, &bd,
+            mkldnn_attr, engine_tgt, NULL);
+
+    mkldnn_primitive_attr_destroy(mkldnn_attr);
+
+    if (init_status == mkldnn_unimplemented)
+        return r->state = UNIMPLEMENTED, OK;
+    else
+        SAFE(init_status, WARN);
+
+    const char *impl_str = query_impl_info(bpd);
+    if (maybe_skip(skip_impl, impl_str)) {
+        print(2, "SKIPPED: mkldnn implementation: %s\n", impl_str);
+        DNN_SAFE(mkldnn_primitive_desc_destroy(bpd), WARN);
+        return r->state = SKIPPED, OK;
+    } else {
+        print(5, "mkldnn implementation: %s\n", impl_str);
+    }
+
+    return OK;
+}
+
+static int compare(const prb_t *p, const dnn_mem_t &fp_mem,
+        const dnn_mem_t &dt_mem, res_t *r) {
+    /* the inputs are small integers, so only the post-ops and bf16 rounding
+     * make the result inexact */
+    const float trh = p->ddt == mkldnn_bf16 ? 1e-2f
+        : p->attr.post_ops.len > 0 ? 1e-5f : 0.f;
+
+    const int64_t nelems = dt_mem.nelems();
+    r->errors = 0;
+    r->total = nelems;
+
+    for (int64_t i = 0; i < nelems; ++i) {
+        const float dt = dt_mem.get_elem(i);
+        const float fp = fp_mem.get_elem(i);
+
+        const float diff = fabsf(fp - dt);
+        const float rel_diff = diff / (fabsf(fp) > FLT_MIN ? fabsf(fp) : 1);
+        const bool ok = (fabsf(fp) > 1e-5 ? rel_diff : diff) <= trh;
+
+        r->errors += !ok;
+
+        const bool dump = false
+            || (!ok && (r->errors < 10 || verbose >= 10))
+            || (verbose >= 50 && i < 30);
+        if (dump) {
+            print(0, "[%4ld] fp:%8g dt:%8g diff:%8g rdiff:%8g\n",
+                    (long)i, fp, dt, diff, rel_diff);
+        }
+    }
+
+    if (r->errors)
+        r->state = FAILED;
+
+    if (r->state == UNTESTED)
+        r->state = PASSED; /* optimism */
+
+    return r->state == FAILED ? FAIL : OK;
+}
+
+/* small integers, non-negative for u8 */
+static int fill_src(const prb_t *p, int input_idx, dnn_mem_t &mem_fp,
+        dnn_mem_t &mem_dt) {
+    const int64_t nelems = mem_fp.nelems();
+    const bool is_unsigned = p->sdt[input_idx] == mkldnn_u8;
+    const int range = input_idx == 0 ? 17 : 13;
+    const int f_min = is_unsigned ? 0 : -(range / 2);
+
+    mkldnn::impl::parallel_nd(nelems, [&](int64_t i) {
+        const int gen = (int)(((input_idx ? 11 : 7) * i + 3) % range);
+        ((float *)mem_fp)[i] = (float)(f_min + gen);
+    });
+
+    SAFE(mem_dt.reorder(mem_fp), WARN);
+    return OK;
+}
+
+int doit(const prb_t *p, res_t *r) {
+    mkldnn_binary_desc_t bd;
+    mkldnn_primitive_desc_t bpd;
+    mkldnn_primitive_t b;
+
+    SAFE(init_pd(p, bd, bpd, r), WARN);
+    if (r->state == SKIPPED || r->state == UNIMPLEMENTED)
+        return OK;
+
+    DNN_SAFE(mkldnn_primitive_create(&b, bpd), WARN);
+
+    const auto q = [&](mkldnn_query_t what, int index) {
+        return *mkldnn_primitive_desc_query_md(bpd, what, index);
+    };
+    const auto src0_md = q(mkldnn_query_src_md, 0);
+    const auto src1_md = q(mkldnn_query_src_md, 1);
+    const auto dst_md = q(mkldnn_query_dst_md, 0);
+
+    DNN_SAFE(mkldnn_primitive_desc_destroy(bpd), CRIT);
+
+    const auto fp = mkldnn_f32;
+    const auto tag = get_default_tag(p->ndims());
+
+    dnn_mem_t src0_fp(src0_md, fp, tag, engine_ref),
+              src0_dt(src0_md, engine_tgt);
+    dnn_mem_t src1_fp(src1_md, fp, tag, engine_ref),
+              src1_dt(src1_md, engine_tgt);
+    dnn_mem_t dst_fp(dst_md, fp, tag, engine_ref),
+              dst_dt(dst_md, engine_tgt);
+
+    SAFE(fill_src(p, 0, src0_fp, src0_dt), WARN);
+    SAFE(fill_src(p, 1, src1_fp, src1_dt), WARN);
+
+    args_t args;
+    args.set(MKLDNN_ARG_SRC_0, src0_dt.m_);
+    args.set(MKLDNN_ARG_SRC_1, src1_dt.m_);
+    args.set(MKLDNN_ARG_DST, dst_dt.m_);
+
+    DNN_SAFE(execute_and_wait(b, stream_tgt, args.size(), args), WARN);
+
+    if (bench_mode & CORR) {
+        compute_ref(p, src0_fp, src1_fp, dst_fp);
+        dnn_mem_t dst(dst_dt, fp, tag, engine_ref);
+        SAFE(compare(p, dst_fp, dst, r), WARN);
+    }
+
+    if (bench_mode & PERF) {
+        auto &t = r->timer;
+        t.reset();
+        while (true) {
+            DNN_SAFE(execute_and_wait(b, stream_tgt, args.size(), args),
+                    WARN);
+            t.stamp();
+            const bool stop = false
+                || (fix_times_per_prb && t.times() >= fix_times_per_prb)
+                || (!fix_times_per_prb
+                        && t.total_ms() >= max_ms_per_prb
+                        && t.times() >= min_times_per_prb);
+            if (stop) break;
+        }
+    }
+
+    DNN_SAFE(mkldnn_primitive_destroy(b), CRIT);
+
+    return OK;
+}
+
+}
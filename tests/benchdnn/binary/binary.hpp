@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef _BINARY_HPP
+#define _BINARY_HPP
+
+#include <vector>
+
+#include "mkldnn.h"
+
+#include "common.hpp"
+#include "dnn_types.hpp"
+#include "mkldnn_common.hpp"
+#include "mkldnn_memory.hpp"
+#include "perf_report.hpp"
+
+namespace binary {
+
+enum alg_t { ADD, MUL, MAX, MIN };
+alg_t str2alg(const char *str);
+const char *alg2str(alg_t alg);
+mkldnn_alg_kind_t alg2alg_kind(alg_t alg);
+
+using dims_t = std::vector<int64_t>;
+
+/* src0 and src1 dimensions, e.g. 2x16x3x3:1x16x1x1; dimensions of src1 are
+ * either equal to those of src0 or to 1 (broadcast) */
+struct desc_t {
+    dims_t dims[2];
+};
+int str2desc(desc_t *desc, const char *str);
+void desc2str(const desc_t *d, char *buffer);
+
+/* pairs of src0 and src1 values, e.g. f32:f32 or nchw:nChw16c */
+std::vector<mkldnn_data_type_t> str2sdt(const char *str);
+std::vector<mkldnn_format_tag_t> str2stag(const char *str);
+
+struct prb_t: public desc_t {
+    prb_t(const desc_t &desc, alg_t alg,
+            const std::vector<mkldnn_data_type_t> &sdt,
+            mkldnn_data_type_t ddt,
+            const std::vector<mkldnn_format_tag_t> &stag, const attr_t &attr)
+        : desc_t(desc), alg(alg), sdt(sdt), ddt(ddt), stag(stag)
+        , attr(attr) {}
+    ~prb_t() {}
+
+    alg_t alg;
+    std::vector<mkldnn_data_type_t> sdt;
+    mkldnn_data_type_t ddt;
+    std::vector<mkldnn_format_tag_t> stag;
+    attr_t attr;
+
+    int ndims() const { return (int)dims[0].size(); }
+};
+void prb2str(const prb_t *p, char *buffer, bool canonical = false);
+
+struct perf_report_t: public base_perf_report_t {
+    perf_report_t(const char *perf_template) :
+        base_perf_report_t(perf_template) {}
+
+    virtual ~perf_report_t() {}
+
+    void report(const prb_t *p, const res_t *r, const char *prb_str) {
+        p_ = p;
+        base_report(r, prb_str);
+    }
+
+    virtual void dump_algorithm(char *buf) const override {
+        dprint(buf, alg2str(p_->alg));
+    }
+
+    virtual void dump_attributes(char *buf) const override {
+        attr2str(&p_->attr, buf);
+    }
+
+    virtual void dump_data_type(char *buf) const override {
+        snprintf(buf, max_dump_len, "%s:%s:%s", dt2str(p_->sdt[0]),
+                dt2str(p_->sdt[1]), dt2str(p_->ddt));
+    }
+
+    virtual void dump_descriptor_csv(char *buf) const override {
+        desc2str(p_, buf);
+    }
+
+    virtual void dump_tag(char *buf) const override {
+        snprintf(buf, max_dump_len, "%s:%s", tag2str(p_->stag[0]),
+                tag2str(p_->stag[1]));
+    }
+
+private:
+    const prb_t *p_;
+};
+
+void compute_ref(const prb_t *p, const dnn_mem_t &src0, const dnn_mem_t &src1,
+        dnn_mem_t &dst);
+
+extern const char *skip_impl; /* NULL or "" means do not skip anything */
+
+int doit(const prb_t *p, res_t *res);
+int bench(int argc, char **argv);
+
+}
+
+#endif
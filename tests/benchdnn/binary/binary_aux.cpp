@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <string>
+
+#include "mkldnn.h"
+
+#include "mkldnn_common.hpp"
+#include "mkldnn_debug.hpp"
+
+#include "binary/binary.hpp"
+
+namespace binary {
+
+alg_t str2alg(const char *str) {
+#define CASE(_alg) if (!strcasecmp(STRINGIFY(_alg), str)) return _alg
+    CASE(ADD);
+    CASE(MUL);
+    CASE(MAX);
+    CASE(MIN);
+#undef CASE
+    assert(!"unknown algorithm");
+    return ADD;
+}
+
+const char *alg2str(alg_t alg) {
+    if (alg == ADD) return "ADD";
+    if (alg == MUL) return "MUL";
+    if (alg == MAX) return "MAX";
+    if (alg == MIN) return "MIN";
+    assert(!"unknown algorithm");
+    return "unknown algorithm";
+}
+
+mkldnn_alg_kind_t alg2alg_kind(alg_t alg) {
+    if (alg == ADD) return mkldnn_binary_add;
+    if (alg == MUL) return mkldnn_binary_mul;
+    if (alg == MAX) return mkldnn_binary_max;
+    if (alg == MIN) return mkldnn_binary_min;
+    assert(!"unknown algorithm");
+    return mkldnn_alg_kind_undef;
+}
+
+static int str2dims(dims_t &dims, const char *&str) {
+    dims.clear();
+    while (true) {
+        int len;
+        int64_t dim;
+        int scan = sscanf(str, IFMT "%n", &dim, &len);
+        if (scan != 1) return FAIL;
+        dims.push_back(dim);
+        str += len;
+        if (*str != 'x') break;
+        ++str;
+    }
+    return OK;
+}
+
+int str2desc(desc_t *desc, const char *str) {
+    desc_t d;
+    for (int i = 0; i < 2; ++i) {
+        if (str2dims(d.dims[i], str) != OK) return FAIL;
+        if (*str != (i == 0 ? ':' : '\0')) return FAIL;
+        ++str;
+    }
+
+    if (d.dims[0].size() != d.dims[1].size()) return FAIL;
+    for (size_t i = 0; i < d.dims[0].size(); ++i)
+        if (d.dims[1][i] != d.dims[0][i] && d.dims[1][i] != 1) return FAIL;
+
+    *desc = d;
+    return OK;
+}
+
+#define DPRINT(...) do { \
+    int l = snprintf(buffer, rem_len, __VA_ARGS__); \
+    buffer += l; rem_len -= l; \
+} while(0)
+
+void desc2str(const desc_t *d, char *buffer) {
+    int rem_len = max_desc_len;
+    for (int i = 0; i < 2; ++i) {
+        const dims_t &dims = d->dims[i];
+        for (size_t j = 0; j < dims.size() - 1; ++j)
+            DPRINT(IFMT "x", dims[j]);
+        DPRINT(IFMT "%s", dims[dims.size() - 1], i == 0 ? ":" : "");
+    }
+}
+
+#undef DPRINT
+
+/* splits `a:b` (or a single `a` that applies to both inputs) */
+template <typename T, typename F>
+static std::vector<T> str2pair(const char *str, F process_func) {
+    std::vector<T> vec;
+    const char *colon = strchr(str, ':');
+    if (colon == NULL) {
+        vec.assign(2, process_func(str));
+    } else {
+        const std::string first(str, colon - str);
+        vec.push_back(process_func(first.c_str()));
+        vec.push_back(process_func(colon + 1));
+    }
+    return vec;
+}
+
+std::vector<mkldnn_data_type_t> str2sdt(const char *str)
+{ return str2pair<mkldnn_data_type_t>(str, str2dt); }
+
+std::vector<mkldnn_format_tag_t> str2stag(const char *str)
+{ return str2pair<mkldnn_format_tag_t>(str, str2tag); }
+
+void prb2str(const prb_t *p, char *buffer, bool canonical) {
+    char alg_str[32] = "", sdt_str[32] = "", ddt_str[32] = "",
+         stag_str[64] = "", attr_buf[max_attr_len] = "",
+         desc_buf[max_desc_len] = "";
+
+    if (p->alg != ADD)
+        snprintf(alg_str, sizeof(alg_str), "--alg=%s ", alg2str(p->alg));
+    if (p->sdt[0] != mkldnn_f32 || p->sdt[1] != mkldnn_f32)
+        snprintf(sdt_str, sizeof(sdt_str), "--sdt=%s:%s ",
+                dt2str(p->sdt[0]), dt2str(p->sdt[1]));
+    if (p->ddt != mkldnn_f32)
+        snprintf(ddt_str, sizeof(ddt_str), "--ddt=%s ", dt2str(p->ddt));
+    if (p->stag[0] != mkldnn_nchw || p->stag[1] != mkldnn_nchw)
+        snprintf(stag_str, sizeof(stag_str), "--stag=%s:%s ",
+                tag2str(p->stag[0]), tag2str(p->stag[1]));
+    if (!p->attr.is_def()) {
+        int len = snprintf(attr_buf, max_attr_len, "--attr=\"");
+        SAFE_V(len >= 0 ? OK : FAIL);
+        attr2str(&p->attr, attr_buf + len);
+        len = (int)strnlen(attr_buf, max_attr_len);
+        snprintf(attr_buf + len, max_attr_len - len, "\" ");
+    }
+    desc2str(p, desc_buf);
+
+    snprintf(buffer, max_prb_len, "%s%s%s%s%s%s", alg_str, sdt_str, ddt_str,
+            stag_str, attr_buf, desc_buf);
+}
+
+}
@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "src/common/mkldnn_thread.hpp"
+
+#include "binary/binary.hpp"
+
+namespace binary {
+
+void compute_ref(const prb_t *p, const dnn_mem_t &src0, const dnn_mem_t &src1,
+        dnn_mem_t &dst) {
+    const int ndims = p->ndims();
+    const int64_t nelems = dst.nelems();
+
+    mkldnn::impl::parallel_nd(nelems, [&](int64_t i) {
+        /* the linear index of src1, broadcast dimensions collapsed */
+        int64_t rem = i, i1 = 0, stride1 = 1;
+        for (int d = ndims - 1; d >= 0; --d) {
+            const int64_t pos = rem % p->dims[0][d];
+            rem /= p->dims[0][d];
+            if (p->dims[1][d] != 1) i1 += pos * stride1;
+            stride1 *= p->dims[1][d];
+        }
+
+        const float x = src0.get_elem(i);
+        const float y = src1.get_elem(i1);
+
+        float res = 0;
+        switch (p->alg) {
+        case ADD: res = x + y; break;
+        case MUL: res = x * y; break;
+        case MAX: res = MAX2(x, y); break;
+        case MIN: res = MIN2(x, y); break;
+        default: assert(!"unknown algorithm");
+        }
+        maybe_post_ops(res, 0.f, p->attr);
+
+        if (p->ddt == mkldnn_s8)
+            res = (float)mxcsr_round(MAX2(-128.f, MIN2(127.f, res)));
+        else if (p->ddt == mkldnn_u8)
+            res = (float)mxcsr_round(MAX2(0.f, MIN2(255.f, res)));
+
+        dst.set_elem(i, res);
+    });
+}
+
+}
@@ -75,6 +75,40 @@ const _dt_conf_t conf_f32_wino = {
     {mkldnn_f32,},
 };
 
+/* bf16 holds integers up to 256 exactly, so only the outputs of the
+ * accumulation are rounded */
+const _dt_conf_t conf_bf16bf16bf16 = {
+    {mkldnn_bf16, -int_max_exact, int_max_exact,  -32,  32, 0, 1, .25, 1e-2},
+    {mkldnn_bf16, -int_max_exact, int_max_exact,  -32,  32, 0, 1, 1.0, 1e-2},
+    {mkldnn_bf16, -int_max_exact, int_max_exact, -128, 128, 0, 1, 1.0, 1e-2},
+    {mkldnn_bf16, -int_max_exact, int_max_exact,  -32,  32, 0, 1, .25, 1e-2},
+    {mkldnn_f32,},
+};
+
+const _dt_conf_t conf_bf16bf16f32 = {
+    {mkldnn_bf16, -int_max_exact, int_max_exact,  -32,  32, 0, 1, .25, 0.},
+    {mkldnn_bf16, -int_max_exact, int_max_exact,  -32,  32, 0, 1, 1.0, 0.},
+    {mkldnn_f32,  -int_max_exact, int_max_exact, -512, 512, 0, 1, 1.0, 0.},
+    {mkldnn_f32,  -int_max_exact, int_max_exact,  -32,  32, 0, 1, .25, 0.},
+    {mkldnn_f32,},
+};
+
+const _dt_conf_t conf_f32bf16bf16 = {
+    {mkldnn_f32,  -int_max_exact, int_max_exact,  -32,  32, 0, 1, .25, 0.},
+    {mkldnn_bf16, -int_max_exact, int_max_exact,  -32,  32, 0, 1, 1.0, 0.},
+    {mkldnn_f32,  -int_max_exact, int_max_exact, -512, 512, 0, 1, 1.0, 0.},
+    {mkldnn_bf16, -int_max_exact, int_max_exact,  -32,  32, 0, 1, .25, 0.},
+    {mkldnn_f32,},
+};
+
+const _dt_conf_t conf_bf16f32bf16 = {
+    {mkldnn_bf16, -int_max_exact, int_max_exact,  -32,  32, 0, 1, .25, 0.},
+    {mkldnn_f32,  -int_max_exact, int_max_exact,  -32,  32, 0, 1, 1.0, 0.},
+    {mkldnn_f32,  -int_max_exact, int_max_exact, -512, 512, 0, 1, 1.0, 0.},
+    {mkldnn_bf16, -int_max_exact, int_max_exact,  -32,  32, 0, 1, .25, 0.},
+    {mkldnn_f32,},
+};
+
 const _dt_conf_t conf_u8s8f32s32 = {
     {mkldnn_u8,          0, UINT8_MAX,    0,   8, 0, 1, .25, 0.},
     {mkldnn_s8,   INT8_MIN,  INT8_MAX,   -5,   5, 0, 1, .25, 0.},
@@ -179,6 +213,10 @@ const dt_conf_t *str2cfg(const char *str) {
     CASE(f32_no_limits);
     CASE(f32_full);
     CASE(f32_wino);
+    CASE(bf16bf16bf16);
+    CASE(bf16bf16f32);
+    CASE(f32bf16bf16);
+    CASE(bf16f32bf16);
     CASE(u8s8f32s32);
     CASE(u8s8s32s32);
     CASE(u8s8s8s32);
@@ -203,6 +241,10 @@ const char *cfg2str(const dt_conf_t *cfg) {
     CASE(f32_no_limits);
     CASE(f32_full);
     CASE(f32_wino);
+    CASE(bf16bf16bf16);
+    CASE(bf16bf16f32);
+    CASE(f32bf16bf16);
+    CASE(bf16f32bf16);
     CASE(u8s8f32s32);
     CASE(u8s8s32s32);
     CASE(u8s8s8s32);
@@ -152,7 +152,8 @@ inline int compare_dat(const prb_t *p, data_kind_t kind, dnn_mem_t &mem_dt,
         const float fp0 = ((float*)mem_fp)[i];
 
         float fp = fp0;
-        if (p->cfg[kind].dt != mkldnn_f16 && p->cfg[kind].dt != mkldnn_f32)
+        if (p->cfg[kind].dt != mkldnn_f16 && p->cfg[kind].dt != mkldnn_f32
+                && p->cfg[kind].dt != mkldnn_bf16)
             fp = mxcsr_round(fp0);
 
         const float diff = fabsf(fp - dt);
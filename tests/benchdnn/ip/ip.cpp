@@ -137,7 +137,8 @@ inline int compare_dat(const prb_t *p, data_kind_t kind, dnn_mem_t &mem_dt,
         float fp0 = ((float *)mem_fp)[i];
 
         float fp = fp0;
-        if (p->cfg[kind].dt != mkldnn_f32)
+        if (p->cfg[kind].dt != mkldnn_f32
+                && p->cfg[kind].dt != mkldnn_bf16)
             fp = mxcsr_round(fp0);
 
         float diff = fabsf(fp - dt);
@@ -0,0 +1,253 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+#include <type_traits>
+
+#include "gtest/gtest.h"
+#include "mkldnn_test_common.hpp"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+struct binary_test_params {
+    algorithm aalgorithm;
+    memory::format_tag src0_format;
+    memory::format_tag src1_format;
+    memory::dims dims0;
+    memory::dims dims1;
+    bool with_relu;
+    bool expect_to_fail;
+    mkldnn_status_t expected_status;
+};
+
+template <typename data_t>
+void check_binary(const binary_test_params &p, const memory &src0,
+        const memory &src1, const memory &dst) {
+    auto src0_ptr = map_memory<data_t>(src0);
+    auto src1_ptr = map_memory<data_t>(src1);
+    auto dst_ptr = map_memory<data_t>(dst);
+
+    const memory::desc src0_d = src0.get_desc();
+    const memory::desc src1_d = src1.get_desc();
+    const memory::desc dst_d = dst.get_desc();
+    const mkldnn::impl::memory_desc_wrapper src0_mdw(src0_d.data);
+    const mkldnn::impl::memory_desc_wrapper src1_mdw(src1_d.data);
+    const mkldnn::impl::memory_desc_wrapper dst_mdw(dst_d.data);
+
+    const int ndims = src0_mdw.ndims();
+    const auto nelems = src0_mdw.nelems();
+
+    for (memory::dim l = 0; l < nelems; ++l) {
+        mkldnn::impl::dims_t pos;
+        memory::dim rem = l;
+        for (int d = ndims - 1; d >= 0; --d) {
+            pos[d] = rem % p.dims0[d];
+            rem /= p.dims0[d];
+        }
+        const float x = src0_ptr[src0_mdw.off_v(pos)];
+        const float d = dst_ptr[dst_mdw.off_v(pos)];
+
+        for (int i = 0; i < ndims; ++i)
+            if (p.dims1[i] == 1) pos[i] = 0;
+        const float y = src1_ptr[src1_mdw.off_v(pos)];
+
+        float ref = 0.f;
+        switch (p.aalgorithm) {
+        case algorithm::binary_add: ref = x + y; break;
+        case algorithm::binary_mul: ref = x * y; break;
+        case algorithm::binary_max: ref = std::max(x, y); break;
+        case algorithm::binary_min: ref = std::min(x, y); break;
+        default: ASSERT_TRUE(!"unknown binary algorithm");
+        }
+        if (p.with_relu) ref = std::max(ref, 0.f);
+        if (!std::is_same<data_t, float>::value)
+            ref = out_round<data_t>(saturate<data_t>(ref));
+
+        ASSERT_NEAR(d, ref, 1e-6f * std::max(1.f, std::fabs(ref)));
+    }
+}
+
+/* set_value() keeps integer data within a few units of zero; stretch it over
+ * the range of data_t so that the results saturate on the way to dst */
+template <typename data_t>
+void stretch_int_data(const memory &mem) {
+    if (std::is_same<data_t, float>::value) return;
+
+    auto ptr = map_memory<data_t>(mem);
+    const memory::dim nelems = mem.get_desc().get_size() / sizeof(data_t);
+    const int scale = std::is_signed<data_t>::value ? 12 : 15;
+    for (memory::dim i = 0; i < nelems; ++i)
+        ptr[i] = data_t(ptr[i] * scale);
+}
+
+template <typename data_t>
+class binary_test : public ::testing::TestWithParam<binary_test_params> {
+    binary_test_params p;
+protected:
+    virtual void SetUp() {
+        p = ::testing::TestWithParam<binary_test_params>::GetParam();
+        catch_expected_failures([=](){Test();}, p.expect_to_fail,
+                    p.expected_status);
+    }
+
+    void Test() {
+        auto eng = engine(get_test_engine_kind(), 0);
+        auto strm = stream(eng);
+
+        memory::data_type prec = data_traits<data_t>::data_type;
+
+        auto src0_desc = memory::desc(p.dims0, prec, p.src0_format);
+        auto src1_desc = memory::desc(p.dims1, prec, p.src1_format);
+        auto dst_desc = memory::desc(p.dims0, prec, memory::format_tag::any);
+
+        primitive_attr attr;
+        if (p.with_relu) {
+            post_ops ops;
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+            attr.set_post_ops(ops);
+        }
+
+        auto binary_desc = binary::desc(p.aalgorithm, src0_desc, src1_desc,
+                dst_desc);
+        auto binary_prim_desc = binary::primitive_desc(binary_desc, attr,
+                eng);
+        Test(binary_prim_desc, eng, strm);
+
+        /* s8 and u8 results are narrowed differently by the avx2 kernel,
+         * which is only reachable by iterating on avx512 machines */
+        if (std::is_same<data_t, float>::value) return;
+        while (binary_prim_desc.next_impl()) {
+            if (std::string(binary_prim_desc.impl_info_str()) == "jit:avx2") {
+                Test(binary_prim_desc, eng, strm);
+                break;
+            }
+        }
+    }
+
+    void Test(const binary::primitive_desc &binary_prim_desc,
+            const engine &eng, stream &strm) {
+        auto src0 = memory(binary_prim_desc.src0_desc(), eng);
+        auto src1 = memory(binary_prim_desc.src1_desc(), eng);
+        auto dst = memory(binary_prim_desc.dst_desc(), eng);
+
+        fill_data<data_t>(src0.get_desc().get_size() / sizeof(data_t),
+                src0, data_t(0), data_t(1));
+        fill_data<data_t>(src1.get_desc().get_size() / sizeof(data_t),
+                src1, data_t(1), data_t(1));
+        stretch_int_data<data_t>(src0);
+        stretch_int_data<data_t>(src1);
+        check_zero_tail<data_t>(1, src0);
+        check_zero_tail<data_t>(1, src1);
+
+        binary(binary_prim_desc).execute(strm, {
+                {MKLDNN_ARG_SRC_0, src0},
+                {MKLDNN_ARG_SRC_1, src1},
+                {MKLDNN_ARG_DST, dst}});
+        strm.wait();
+
+        check_binary<data_t>(p, src0, src1, dst);
+        check_zero_tail<data_t>(0, dst);
+    }
+};
+
+using binary_test_float = binary_test<float>;
+using binary_test_s8 = binary_test<int8_t>;
+using binary_test_u8 = binary_test<uint8_t>;
+using fmt = memory::format_tag;
+
+TEST_P(binary_test_float, TestsBinary) { }
+TEST_P(binary_test_s8, TestsBinary) { }
+TEST_P(binary_test_u8, TestsBinary) { }
+
+INSTANTIATE_TEST_SUITE_P(TestBinaryEF, binary_test_float,
+        ::testing::Values(
+            binary_test_params{algorithm::binary_add, fmt::nchw, fmt::nchw,
+            {2, 3, 4, 5}, {2, 3, 4, 6}, false,
+            true, mkldnn_invalid_arguments},
+            binary_test_params{algorithm::binary_add, fmt::nchw, fmt::nchw,
+            {2, 3, 4, 5}, {2, 3, 4}, false,
+            true, mkldnn_invalid_arguments},
+            binary_test_params{algorithm::eltwise_relu, fmt::nchw, fmt::nchw,
+            {2, 3, 4, 5}, {2, 3, 4, 5}, false,
+            true, mkldnn_invalid_arguments}
+            ));
+
+INSTANTIATE_TEST_SUITE_P(TestBinaryTensor, binary_test_float,
+        ::testing::Values(
+            binary_test_params{algorithm::binary_add, fmt::nchw, fmt::nchw,
+            {2, 19, 7, 5}, {2, 19, 7, 5}, false},
+            binary_test_params{algorithm::binary_mul, fmt::nhwc, fmt::nhwc,
+            {3, 17, 4, 9}, {3, 17, 4, 9}, false},
+            binary_test_params{algorithm::binary_max, fmt::nChw16c,
+            fmt::nChw16c, {2, 35, 3, 3}, {2, 35, 3, 3}, true},
+            binary_test_params{algorithm::binary_min, fmt::nChw8c, fmt::nChw8c,
+            {2, 13, 3, 3}, {2, 13, 3, 3}, false},
+            binary_test_params{algorithm::binary_add, fmt::nchw, fmt::nhwc,
+            {2, 5, 3, 3}, {2, 5, 3, 3}, true},
+            binary_test_params{algorithm::binary_add, fmt::nc, fmt::nc,
+            {1, 1}, {1, 1}, false}
+            ));
+
+INSTANTIATE_TEST_SUITE_P(TestBinaryBroadcast, binary_test_float,
+        ::testing::Values(
+            binary_test_params{algorithm::binary_add, fmt::nchw, fmt::nchw,
+            {2, 19, 7, 5}, {1, 1, 1, 1}, false},
+            binary_test_params{algorithm::binary_mul, fmt::nchw, fmt::nchw,
+            {2, 19, 7, 5}, {1, 19, 1, 1}, true},
+            binary_test_params{algorithm::binary_add, fmt::nhwc, fmt::nhwc,
+            {3, 21, 4, 5}, {3, 21, 1, 1}, false},
+            binary_test_params{algorithm::binary_max, fmt::nChw16c, fmt::nchw,
+            {2, 35, 3, 3}, {1, 35, 1, 1}, false},
+            binary_test_params{algorithm::binary_min, fmt::nChw8c, fmt::nchw,
+            {2, 13, 5, 1}, {2, 1, 1, 1}, true},
+            binary_test_params{algorithm::binary_add, fmt::nChw16c, fmt::nchw,
+            {2, 3, 3, 3}, {1, 1, 1, 1}, false},
+            binary_test_params{algorithm::binary_mul, fmt::nc, fmt::nc,
+            {7, 33}, {1, 33}, false},
+            binary_test_params{algorithm::binary_add, fmt::ncdhw, fmt::ncdhw,
+            {2, 3, 2, 3, 4}, {2, 3, 1, 1, 1}, false},
+            binary_test_params{algorithm::binary_add, fmt::nchw, fmt::nchw,
+            {2, 3, 4, 5}, {2, 3, 4, 1}, false}
+            ));
+
+INSTANTIATE_TEST_SUITE_P(TestBinaryFormatAny, binary_test_float,
+        ::testing::Values(
+            binary_test_params{algorithm::binary_add, fmt::any, fmt::nchw,
+            {2, 16, 3, 3}, {1, 16, 1, 1}, false},
+            binary_test_params{algorithm::binary_mul, fmt::nChw16c, fmt::any,
+            {2, 16, 3, 3}, {2, 16, 3, 3}, false}
+            ));
+
+#define INT8_BINARY_TEST_PARAMS ::testing::Values( \
+            binary_test_params{algorithm::binary_add, fmt::nchw, fmt::nchw, \
+            {2, 19, 7, 5}, {2, 19, 7, 5}, false}, \
+            binary_test_params{algorithm::binary_mul, fmt::nhwc, fmt::nhwc, \
+            {3, 17, 4, 9}, {3, 17, 4, 9}, false}, \
+            binary_test_params{algorithm::binary_max, fmt::nChw16c, \
+            fmt::nChw16c, {2, 35, 3, 3}, {2, 35, 3, 3}, true}, \
+            binary_test_params{algorithm::binary_add, fmt::nChw8c, fmt::nchw, \
+            {2, 13, 5, 1}, {1, 13, 1, 1}, true}, \
+            binary_test_params{algorithm::binary_mul, fmt::nchw, fmt::nchw, \
+            {2, 19, 7, 5}, {1, 1, 1, 1}, false})
+
+INSTANTIATE_TEST_SUITE_P(TestBinaryS8, binary_test_s8,
+        INT8_BINARY_TEST_PARAMS);
+INSTANTIATE_TEST_SUITE_P(TestBinaryU8, binary_test_u8,
+        INT8_BINARY_TEST_PARAMS);
+
+}
@@ -0,0 +1,179 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+#include "cpu_isa_traits.hpp"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+struct dw_fusion_test_params {
+    memory::dim mb, ic, oc, h, w;
+    bool with_eltwise;
+};
+
+/* Runs a 1x1 convolution with a fused 3x3 depthwise convolution and checks
+ * it against the two convolutions run one after the other. The depthwise
+ * weights and output descriptors are taken from the fused primitive. */
+template <typename src_t, typename wei_t, typename mid_t, typename dst_t>
+class convolution_dw_fusion_test
+    : public ::testing::TestWithParam<dw_fusion_test_params> {
+protected:
+    virtual void SetUp() {
+        bool is_int8 = data_traits<src_t>::data_type != dt::f32;
+        if (!impl::cpu::mayiuse(is_int8
+                    ? impl::cpu::avx512_core : impl::cpu::avx512_common))
+            return;
+
+        auto p = ::testing::TestWithParam<dw_fusion_test_params>::GetParam();
+        auto eng = engine(get_test_engine_kind(), 0);
+        auto strm = stream(eng);
+
+        dt src_dt = data_traits<src_t>::data_type;
+        dt wei_dt = data_traits<wei_t>::data_type;
+        dt mid_dt = data_traits<mid_t>::data_type;
+        dt dst_dt = data_traits<dst_t>::data_type;
+
+        auto src_md = create_md({p.mb, p.ic, p.h, p.w}, src_dt, tag::any);
+        auto wei_md = create_md({p.oc, p.ic, 1, 1}, wei_dt, tag::any);
+        auto bia_md = create_md({p.oc}, dt::f32, tag::x);
+        auto mid_md = create_md({p.mb, p.oc, p.h, p.w}, mid_dt, tag::any);
+
+        const float scale_1x1 = is_int8 ? 0.25f : 1.f;
+        const float scale_dw = is_int8 ? 0.5f : 1.f;
+
+        post_ops ops_1x1;
+        if (p.with_eltwise)
+            ops_1x1.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+
+        post_ops ops;
+        if (p.with_eltwise)
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        ops.append_dw_k3s1p1(memory::convert_to_c(wei_dt),
+                memory::convert_to_c(dt::f32), memory::convert_to_c(dst_dt),
+                0, {scale_dw});
+        if (p.with_eltwise)
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+
+        primitive_attr attr;
+        attr.set_output_scales(0, {scale_1x1});
+        attr.set_post_ops(ops);
+
+        auto conv_1x1_desc = convolution_forward::desc(
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_md, bia_md, mid_md, {1, 1}, {0, 0}, {0, 0});
+        auto fused_pd = convolution_forward::primitive_desc(
+                conv_1x1_desc, attr, eng);
+
+        auto wei_dw_md = fused_pd.query_md(query::weights_md, 2);
+        auto bia_dw_md = fused_pd.query_md(query::weights_md, 3);
+        auto dst_md = fused_pd.dst_desc();
+        ASSERT_EQ(dst_md.data.data_type, static_cast<mkldnn_data_type_t>(
+                    memory::convert_to_c(dst_dt)));
+
+        auto src = memory(fused_pd.src_desc(), eng);
+        auto wei = memory(fused_pd.weights_desc(), eng);
+        auto bia = memory(fused_pd.bias_desc(), eng);
+        auto wei_dw = memory(wei_dw_md, eng);
+        auto bia_dw = memory(bia_dw_md, eng);
+        auto dst = memory(dst_md, eng);
+        auto dst_ref = memory(dst_md, eng);
+
+        fill_data<src_t>(src.get_desc().get_size() / sizeof(src_t), src,
+                src_t(0), src_t(1));
+        fill_data<wei_t>(wei.get_desc().get_size() / sizeof(wei_t), wei,
+                wei_t(0), wei_t(1));
+        fill_data<float>(p.oc, bia, 1., true);
+        fill_data<wei_t>(wei_dw.get_desc().get_size() / sizeof(wei_t),
+                wei_dw, wei_t(0), wei_t(1));
+        fill_data<float>(p.oc, bia_dw, 1., true);
+
+        convolution_forward(fused_pd).execute(strm, {
+                {MKLDNN_ARG_SRC, src},
+                {MKLDNN_ARG_WEIGHTS, wei},
+                {MKLDNN_ARG_BIAS, bia},
+                {MKLDNN_ARG_ATTR_POST_OP_DW | MKLDNN_ARG_WEIGHTS, wei_dw},
+                {MKLDNN_ARG_ATTR_POST_OP_DW | MKLDNN_ARG_BIAS, bia_dw},
+                {MKLDNN_ARG_DST, dst}});
+
+        primitive_attr attr_1x1;
+        attr_1x1.set_output_scales(0, {scale_1x1});
+        attr_1x1.set_post_ops(ops_1x1);
+        auto ref_1x1_desc = convolution_forward::desc(
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                fused_pd.src_desc(), fused_pd.weights_desc(),
+                fused_pd.bias_desc(), mid_md, {1, 1}, {0, 0}, {0, 0});
+        auto ref_1x1_pd = convolution_forward::primitive_desc(
+                ref_1x1_desc, attr_1x1, eng);
+        auto mid = memory(ref_1x1_pd.dst_desc(), eng);
+
+        convolution_forward(ref_1x1_pd).execute(strm, {
+                {MKLDNN_ARG_SRC, src},
+                {MKLDNN_ARG_WEIGHTS, wei},
+                {MKLDNN_ARG_BIAS, bia},
+                {MKLDNN_ARG_DST, mid}});
+
+        post_ops ops_dw;
+        if (p.with_eltwise)
+            ops_dw.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        primitive_attr attr_dw;
+        if (is_int8)
+            attr_dw.set_output_scales(0, {scale_dw});
+        attr_dw.set_post_ops(ops_dw);
+        auto ref_dw_desc = convolution_forward::desc(
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                ref_1x1_pd.dst_desc(), wei_dw_md, bia_dw_md, dst_md,
+                {1, 1}, {0, 0}, {1, 1}, {1, 1});
+        auto ref_dw_pd = convolution_forward::primitive_desc(
+                ref_dw_desc, attr_dw, eng);
+
+        convolution_forward(ref_dw_pd).execute(strm, {
+                {MKLDNN_ARG_SRC, mid},
+                {MKLDNN_ARG_WEIGHTS, wei_dw},
+                {MKLDNN_ARG_BIAS, bia_dw},
+                {MKLDNN_ARG_DST, dst_ref}});
+        strm.wait();
+
+        compare_data<dst_t>(dst_ref, dst);
+    }
+};
+
+using dw_fusion_test_f32
+    = convolution_dw_fusion_test<float, float, float, float>;
+using dw_fusion_test_u8s8u8f32
+    = convolution_dw_fusion_test<uint8_t, int8_t, uint8_t, float>;
+
+TEST_P(dw_fusion_test_f32, TestsConvolutionDwFusion) {}
+TEST_P(dw_fusion_test_u8s8u8f32, TestsConvolutionDwFusion) {}
+
+#define DW_FUSION_PARAMS ::testing::Values( \
+        dw_fusion_test_params{1, 32, 32, 7, 7, false}, \
+        dw_fusion_test_params{2, 16, 64, 13, 13, true}, \
+        dw_fusion_test_params{2, 64, 32, 28, 28, true}, \
+        dw_fusion_test_params{1, 32, 96, 56, 56, true}, \
+        dw_fusion_test_params{3, 48, 16, 9, 20, false})
+
+CPU_INSTANTIATE_TEST_SUITE_P(TestConvolutionDwFusion, dw_fusion_test_f32,
+        DW_FUSION_PARAMS);
+CPU_INSTANTIATE_TEST_SUITE_P(TestConvolutionDwFusion,
+        dw_fusion_test_u8s8u8f32, DW_FUSION_PARAMS);
+
+}
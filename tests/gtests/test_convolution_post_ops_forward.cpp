@@ -0,0 +1,208 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+#include "cpu_isa_traits.hpp"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+enum class rhs_bcast { scalar, per_oc, none };
+
+struct post_ops_test_params {
+    memory::dim mb, ic, oc, h, w, k;
+    bool with_sum;
+    rhs_bcast bcast;
+};
+
+/* Runs a convolution with a chain of sum, scale_shift, binary and eltwise
+ * post-ops, longer than the former limit of four entries, and checks it
+ * against the same convolution without post-ops followed by the chain
+ * computed here. */
+template <typename src_t, typename wei_t>
+class convolution_post_ops_test
+    : public ::testing::TestWithParam<post_ops_test_params> {
+protected:
+    virtual void SetUp() {
+        bool is_int8 = data_traits<src_t>::data_type != dt::f32;
+        if (!impl::cpu::mayiuse(is_int8
+                    ? impl::cpu::avx512_core : impl::cpu::avx512_common))
+            return;
+
+        auto p = ::testing::TestWithParam<post_ops_test_params>::GetParam();
+        auto eng = engine(get_test_engine_kind(), 0);
+        auto strm = stream(eng);
+
+        dt src_dt = data_traits<src_t>::data_type;
+        dt wei_dt = data_traits<wei_t>::data_type;
+        const memory::dim pad = p.k / 2;
+
+        auto src_md = create_md({p.mb, p.ic, p.h, p.w}, src_dt, tag::any);
+        auto wei_md = create_md({p.oc, p.ic, p.k, p.k}, wei_dt, tag::any);
+        auto bia_md = create_md({p.oc}, dt::f32, tag::x);
+        auto dst_md = create_md({p.mb, p.oc, p.h, p.w}, dt::f32,
+                is_int8 ? tag::nhwc : tag::nChw16c);
+
+        auto conv_desc = convolution_forward::desc(
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_md, bia_md, dst_md, {1, 1}, {pad, pad},
+                {pad, pad});
+
+        /* src1 of the binary post-ops */
+        memory::desc rhs_md = dst_md;
+        if (p.bcast == rhs_bcast::scalar)
+            rhs_md = create_md({1, 1, 1, 1}, dt::f32, tag::nchw);
+        else if (p.bcast == rhs_bcast::per_oc)
+            rhs_md = create_md({1, p.oc, 1, 1}, dt::f32, tag::nchw);
+        auto oc_md = create_md({1, p.oc, 1, 1}, dt::f32, tag::nchw);
+
+        std::vector<float> bn_scales(p.oc), bn_shifts(p.oc);
+        for (memory::dim c = 0; c < p.oc; c++) {
+            bn_scales[c] = 0.5f + (c % 7) * 0.25f;
+            bn_shifts[c] = (c % 5) - 2.f;
+        }
+        const float common_scale = 0.75f, common_shift = 0.5f;
+
+        post_ops ops;
+        if (p.with_sum)
+            ops.append_sum(1.f);
+        ops.append_scale_shift(1 << 1, bn_scales, bn_shifts);
+        ops.append_binary(algorithm::binary_add, rhs_md.data);
+        ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        ops.append_scale_shift(0, {common_scale}, {common_shift});
+        ops.append_binary(algorithm::binary_mul, oc_md.data);
+        ops.append_binary(algorithm::binary_min, rhs_md.data);
+        const int rhs_add_idx = p.with_sum + 1;
+        const int oc_mul_idx = p.with_sum + 4;
+        const int rhs_min_idx = p.with_sum + 5;
+
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+        auto fused_pd = convolution_forward::primitive_desc(
+                conv_desc, attr, eng);
+
+        /* the 1x1 kernels do not apply scale_shift and binary post-ops, so a
+         * 1x1 shape must fall back to the direct kernel */
+        if (p.k == 1)
+            ASSERT_EQ(std::string(fused_pd.impl_info_str()).find("1x1"),
+                    std::string::npos);
+
+        auto ref_desc = convolution_forward::desc(
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                fused_pd.src_desc(), fused_pd.weights_desc(),
+                fused_pd.bias_desc(), dst_md, {1, 1}, {pad, pad}, {pad, pad});
+        auto ref_pd = convolution_forward::primitive_desc(ref_desc, eng);
+
+        auto src = memory(fused_pd.src_desc(), eng);
+        auto wei = memory(fused_pd.weights_desc(), eng);
+        auto bia = memory(fused_pd.bias_desc(), eng);
+        auto dst = memory(fused_pd.dst_desc(), eng);
+        auto dst_ref = memory(ref_pd.dst_desc(), eng);
+        auto rhs = memory(rhs_md, eng);
+        auto oc_rhs = memory(oc_md, eng);
+
+        const size_t dst_size = dst.get_desc().get_size() / sizeof(float);
+        const size_t rhs_size = rhs.get_desc().get_size() / sizeof(float);
+        fill_data<src_t>(src.get_desc().get_size() / sizeof(src_t), src,
+                src_t(0), src_t(1));
+        fill_data<wei_t>(wei.get_desc().get_size() / sizeof(wei_t), wei,
+                wei_t(0), wei_t(1));
+        fill_data<float>(p.oc, bia, 1., true);
+        fill_data<float>(dst_size, dst, 1., true);
+        fill_data<float>(rhs_size, rhs, 0.5f, 1.f);
+        fill_data<float>(p.oc, oc_rhs, 1.f, 0.5f);
+
+        std::vector<float> prev_dst(dst_size);
+        {
+            auto dst_data = map_memory<float>(dst);
+            for (size_t i = 0; i < dst_size; i++)
+                prev_dst[i] = dst_data[i];
+        }
+
+        convolution_forward(fused_pd).execute(strm, {
+                {MKLDNN_ARG_SRC, src},
+                {MKLDNN_ARG_WEIGHTS, wei},
+                {MKLDNN_ARG_BIAS, bia},
+                {MKLDNN_ARG_ATTR_MULTIPLE_POST_OP(rhs_add_idx)
+                    | MKLDNN_ARG_SRC_1, rhs},
+                {MKLDNN_ARG_ATTR_MULTIPLE_POST_OP(oc_mul_idx)
+                    | MKLDNN_ARG_SRC_1, oc_rhs},
+                {MKLDNN_ARG_ATTR_MULTIPLE_POST_OP(rhs_min_idx)
+                    | MKLDNN_ARG_SRC_1, rhs},
+                {MKLDNN_ARG_DST, dst}});
+
+        convolution_forward(ref_pd).execute(strm, {
+                {MKLDNN_ARG_SRC, src},
+                {MKLDNN_ARG_WEIGHTS, wei},
+                {MKLDNN_ARG_BIAS, bia},
+                {MKLDNN_ARG_DST, dst_ref}});
+        strm.wait();
+
+        auto ref_data = map_memory<float>(dst_ref);
+        auto rhs_data = map_memory<float>(rhs);
+        auto oc_rhs_data = map_memory<float>(oc_rhs);
+        const memory::desc dst_ref_d = dst_ref.get_desc();
+        const mkldnn::impl::memory_desc_wrapper dst_mdw(dst_ref_d.data);
+
+        for (memory::dim n = 0; n < p.mb; n++)
+        for (memory::dim c = 0; c < p.oc; c++)
+        for (memory::dim h = 0; h < p.h; h++)
+        for (memory::dim w = 0; w < p.w; w++) {
+            const auto off = dst_mdw.off(n, c, h, w);
+            const float r = p.bcast == rhs_bcast::scalar ? rhs_data[0]
+                : p.bcast == rhs_bcast::per_oc ? rhs_data[c] : rhs_data[off];
+
+            float d = ref_data[off];
+            if (p.with_sum)
+                d += prev_dst[off];
+            d = bn_scales[c] * d + bn_shifts[c];
+            d += r;
+            d = d > 0.f ? d : 0.f;
+            d = common_scale * d + common_shift;
+            d *= oc_rhs_data[c];
+            d = d < r ? d : r;
+            ref_data[off] = d;
+        }
+
+        compare_data<float>(dst_ref, dst);
+    }
+};
+
+using post_ops_test_f32 = convolution_post_ops_test<float, float>;
+using post_ops_test_u8s8f32 = convolution_post_ops_test<uint8_t, int8_t>;
+
+TEST_P(post_ops_test_f32, TestsConvolutionPostOps) {}
+TEST_P(post_ops_test_u8s8f32, TestsConvolutionPostOps) {}
+
+#define POST_OPS_PARAMS ::testing::Values( \
+        post_ops_test_params{1, 16, 32, 7, 7, 3, false, rhs_bcast::none}, \
+        post_ops_test_params{2, 32, 16, 13, 13, 3, true, rhs_bcast::none}, \
+        post_ops_test_params{2, 16, 64, 9, 20, 1, true, rhs_bcast::per_oc}, \
+        post_ops_test_params{1, 32, 32, 7, 7, 1, false, rhs_bcast::none}, \
+        post_ops_test_params{3, 48, 32, 14, 14, 3, false, rhs_bcast::scalar}, \
+        post_ops_test_params{1, 64, 48, 28, 28, 3, true, rhs_bcast::none})
+
+CPU_INSTANTIATE_TEST_SUITE_P(TestConvolutionPostOps, post_ops_test_f32,
+        POST_OPS_PARAMS);
+CPU_INSTANTIATE_TEST_SUITE_P(TestConvolutionPostOps, post_ops_test_u8s8f32,
+        POST_OPS_PARAMS);
+
+}
@@ -118,6 +118,16 @@ T logistic_bwd(T dd, T s) {
     return dd * v * (1 - v);
 }
 
+template <typename T>
+T exp_fwd(T s) {
+    return (T)(::expf((float)s));
+}
+
+template <typename T>
+T exp_bwd(T dd, T s) {
+    return (T)((float)dd * ::expf((float)s));
+}
+
 struct eltwise_test_params {
     algorithm alg_kind;
     memory::format_tag data_format;
@@ -158,6 +168,7 @@ void check_eltwise_fwd(const eltwise_test_params &p,
         case algorithm::eltwise_bounded_relu: ref_d = bounded_relu_fwd(s, p.alpha);  break;
         case algorithm::eltwise_soft_relu:   ref_d = soft_relu_fwd(s);               break;
         case algorithm::eltwise_logistic:    ref_d = logistic_fwd(s);                break;
+        case algorithm::eltwise_exp:         ref_d = exp_fwd(s);                     break;
         default: assert(!"unknown alg_kind");
         }
         dst_data[i] = ref_d;
@@ -220,6 +231,7 @@ void check_eltwise_bwd(const eltwise_test_params &p,
             ref_ds = soft_relu_bwd(ref_dd, ref_s);
             break;
         case algorithm::eltwise_logistic: ref_ds = logistic_bwd(ref_dd, ref_s); break;
+        case algorithm::eltwise_exp: ref_ds = exp_bwd(ref_dd, ref_s); break;
         default: assert(!"unknown alg_kind");
         }
 
@@ -284,7 +296,9 @@ protected:
                 = p.alg_kind == algorithm::eltwise_elu
                 ? data_t(1.0)
                 : p.alg_kind == algorithm::eltwise_square
-                    ? data_t(6.0) : data_t(200.0);
+                    ? data_t(6.0)
+                : p.alg_kind == algorithm::eltwise_exp
+                    ? data_t(10.0) : data_t(200.0);
         fill_data<data_t>(n_elems(*data_desc), src, data_median, data_deviation);
         check_zero_tail<data_t>(1, src);
 
@@ -368,7 +382,8 @@ TEST_P(eltwise_test_bfloat16, TestsEltwise)
     EXPAND(PARAMS(eltwise_linear, __VA_ARGS__)), \
     EXPAND(PARAMS(eltwise_soft_relu, __VA_ARGS__)), \
     EXPAND(PARAMS(eltwise_bounded_relu, __VA_ARGS__)), \
-    EXPAND(PARAMS(eltwise_logistic, __VA_ARGS__))
+    EXPAND(PARAMS(eltwise_logistic, __VA_ARGS__)), \
+    EXPAND(PARAMS(eltwise_exp, __VA_ARGS__))
 
 #define CPU_INST_TEST_CASE(str, ...) \
     CPU_INSTANTIATE_TEST_SUITE_P( \
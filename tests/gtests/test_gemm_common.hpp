@@ -191,7 +191,8 @@ void prepare_matrix(const test_memory &M_mem, int64_t off_beg, layout_t layout,
         int64_t C, int64_t LD, const mapper_t &mapper) {
     auto M = map_memory<data_t>(M_mem);
     auto dt = data_traits<data_t>::data_type;
-    bool is_fp = (dt == memory::data_type::f16 || dt == memory::data_type::f32);
+    bool is_fp = (dt == memory::data_type::f16 || dt == memory::data_type::f32
+            || dt == memory::data_type::bf16);
     const data_t mean = (data_t)(is_fp ? 1.f : 4);
     const data_t var = (data_t)(is_fp ? 2e-1f : 3);
 
@@ -366,7 +367,8 @@ void compare(const test_params &p, const test_memory &c_mem,
             const float eps = 1e-3 * p.K;
             float e = (std::abs(ref) > eps) ? diff / ref : float(diff);
             ASSERT_NEAR(e, 0.0, eps) << "Row: " << j << " Col: " << i;
-        } else if (data_traits<b_dt>::data_type == data_type::f32) {
+        } else if (data_traits<b_dt>::data_type == data_type::f32
+                || data_traits<b_dt>::data_type == data_type::bf16) {
             c_dt e = (std::abs(ref) > 1e-4) ? c_dt(diff / ref) : diff;
             ASSERT_NEAR(e, 0.0, 1e-4) << "Row: " << j << " Col: " << i;
         } else {
@@ -494,6 +496,20 @@ struct mkldnn_gemm<float, float, float> {
     }
 };
 
+template <>
+struct mkldnn_gemm<bfloat16_t, bfloat16_t, float> {
+    static mkldnn_status_t call(const test_params &p, const test_memory &a_mem,
+            const test_memory &b_mem, const test_memory &c_mem,
+            const test_memory &) {
+        auto A = map_memory<bfloat16_t>(a_mem);
+        auto B = map_memory<bfloat16_t>(b_mem);
+        auto C = map_memory<float>(c_mem);
+        return mkldnn_gemm_bf16bf16f32(&p.transA, &p.transB, &p.M, &p.N, &p.K,
+                &p.alpha, (const uint16_t *)(bfloat16_t *)A, &p.lda,
+                (const uint16_t *)(bfloat16_t *)B, &p.ldb, &p.beta, C, &p.ldc);
+    }
+};
+
 template <>
 struct mkldnn_gemm<int8_t, int8_t, int32_t> {
     static mkldnn_status_t call(const test_params &p, const test_memory &a_mem,
@@ -589,6 +605,11 @@ protected:
         SKIP_IF(is_f16 && get_test_engine_kind() == engine::kind::cpu,
                 "CPU does not support f16 data type.");
 
+        bool is_bf16 = (data_traits<a_dt>::data_type
+                == memory::data_type::bf16);
+        SKIP_IF(is_bf16 && get_test_engine_kind() != engine::kind::cpu,
+                "GPU does not support bf16 data type.");
+
         catch_expected_failures([=](){Test();}, p.expect_to_fail,
                     p.expected_status);
     }
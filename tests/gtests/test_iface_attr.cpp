@@ -120,6 +120,45 @@ TEST_F(attr_test, TestPostOps) {
     ASSERT_EQ(alg, algorithm::eltwise_bounded_relu);
     ASSERT_FLOAT_EQ(alpha, 3.3f);
     ASSERT_FLOAT_EQ(beta, 4.4f);
+
+    const std::vector<float> ss_scales = {1.f, 2.f, 3.f};
+    const std::vector<float> ss_shifts = {4.f, 5.f, 6.f};
+    ops.append_scale_shift(1 << 1, ss_scales, ss_shifts);
+    ops.append_scale_shift(0, {7.f});
+
+    memory::desc src1_md({2, 3, 4, 5}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    ops.append_binary(algorithm::binary_max, src1_md.data);
+    attr.set_post_ops(ops);
+
+    ASSERT_EQ(attr.get_post_ops().len(), 5);
+    ASSERT_EQ(attr.get_post_ops().kind(2),
+            primitive::kind::batch_normalization);
+    ASSERT_EQ(attr.get_post_ops().kind(3),
+            primitive::kind::batch_normalization);
+    ASSERT_EQ(attr.get_post_ops().kind(4), primitive::kind::binary);
+
+    int mask;
+    std::vector<float> scales, shifts;
+    attr.get_post_ops().get_params_scale_shift(2, mask, scales, shifts);
+    ASSERT_EQ(mask, 1 << 1);
+    ASSERT_EQ(scales, ss_scales);
+    ASSERT_EQ(shifts, ss_shifts);
+
+    attr.get_post_ops().get_params_scale_shift(3, mask, scales, shifts);
+    ASSERT_EQ(mask, 0);
+    ASSERT_EQ(scales, std::vector<float>(1, 7.f));
+    ASSERT_EQ(shifts, std::vector<float>(1, 0.f));
+
+    mkldnn_memory_desc_t md;
+    attr.get_post_ops().get_params_binary(4, alg, md);
+    ASSERT_EQ(alg, algorithm::binary_max);
+    ASSERT_TRUE(memory::desc(md) == src1_md);
+
+    EXPECT_ANY_THROW(ops.append_scale_shift(1 << 1, ss_scales, {1.f}));
+    EXPECT_ANY_THROW(
+            ops.append_binary(algorithm::eltwise_relu, src1_md.data));
+    ASSERT_EQ(ops.len(), 5);
 }
 
 }
@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "mkldnn_test_common.hpp"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+struct logsoftmax_test_params {
+    memory::format_tag memory_format;
+    memory::dims dims;
+    int axis;
+};
+
+/* Checks logsoftmax forward against a double precision reference, and the
+ * backward pass on the forward results: diff_src = diff_dst - exp(dst) *
+ * sum(diff_dst) along the axis. */
+class logsoftmax_test
+    : public ::testing::TestWithParam<logsoftmax_test_params> {
+protected:
+    virtual void SetUp() {
+        p = ::testing::TestWithParam<logsoftmax_test_params>::GetParam();
+        Test();
+    }
+
+    void Test() {
+        auto eng = engine(get_test_engine_kind(), 0);
+        auto strm = stream(eng);
+
+        auto mem_desc = memory::desc(p.dims, memory::data_type::f32,
+                p.memory_format);
+        const memory::dim nelems = mem_desc.get_size() / sizeof(float);
+
+        auto src = memory(mem_desc, eng);
+        auto dst = memory(mem_desc, eng);
+        auto diff_dst = memory(mem_desc, eng);
+        auto diff_src = memory(mem_desc, eng);
+
+        auto fwd_desc = logsoftmax_forward::desc(prop_kind::forward_training,
+                mem_desc, p.axis);
+        auto fwd_pd = logsoftmax_forward::primitive_desc(fwd_desc, eng);
+        ASSERT_EQ(fwd_pd.src_desc(), mem_desc);
+
+        auto bwd_desc = logsoftmax_backward::desc(mem_desc, mem_desc, p.axis);
+        auto bwd_pd = logsoftmax_backward::primitive_desc(
+                bwd_desc, eng, fwd_pd);
+
+        /* a wide spread of values, which would underflow exp() in softmax */
+        fill_data<float>(nelems, src, 0.f, 200.f);
+        check_zero_tail<float>(1, src);
+        fill_data<float>(nelems, diff_dst, 0.f, 1.f);
+        check_zero_tail<float>(1, diff_dst);
+
+        logsoftmax_forward(fwd_pd).execute(strm,
+                {{MKLDNN_ARG_SRC, src}, {MKLDNN_ARG_DST, dst}});
+        logsoftmax_backward(bwd_pd).execute(strm,
+                {{MKLDNN_ARG_DST, dst}, {MKLDNN_ARG_DIFF_DST, diff_dst},
+                {MKLDNN_ARG_DIFF_SRC, diff_src}});
+        strm.wait();
+
+        check(src, dst, diff_dst, diff_src);
+        check_zero_tail<float>(0, dst);
+        check_zero_tail<float>(0, diff_src);
+    }
+
+    void check(const memory &src, const memory &dst, const memory &diff_dst,
+            const memory &diff_src) {
+        auto src_ptr = map_memory<float>(src);
+        auto dst_ptr = map_memory<float>(dst);
+        auto diff_dst_ptr = map_memory<float>(diff_dst);
+        auto diff_src_ptr = map_memory<float>(diff_src);
+
+        const memory::desc md = src.get_desc();
+        const mkldnn::impl::memory_desc_wrapper mdw(md.data);
+
+        memory::dim outer = 1, inner = 1;
+        for (int d = 0; d < p.axis; ++d)
+            outer *= p.dims[d];
+        for (int d = p.axis + 1; d < (int)p.dims.size(); ++d)
+            inner *= p.dims[d];
+        const memory::dim axis_size = p.dims[p.axis];
+
+        for (memory::dim ou = 0; ou < outer; ++ou)
+        for (memory::dim in = 0; in < inner; ++in) {
+            auto off = [&](memory::dim c)
+            { return mdw.off_l((ou * axis_size + c) * inner + in); };
+
+            double max = -INFINITY, sum = 0, diff_sum = 0;
+            for (memory::dim c = 0; c < axis_size; ++c)
+                max = std::max(max, (double)src_ptr[off(c)]);
+            for (memory::dim c = 0; c < axis_size; ++c) {
+                sum += std::exp(src_ptr[off(c)] - max);
+                diff_sum += diff_dst_ptr[off(c)];
+            }
+
+            for (memory::dim c = 0; c < axis_size; ++c) {
+                const double ref = src_ptr[off(c)] - max - std::log(sum);
+                ASSERT_NEAR(dst_ptr[off(c)], ref,
+                        1e-5 * std::max(1., std::fabs(ref)));
+
+                const double ref_diff = diff_dst_ptr[off(c)]
+                    - std::exp((double)dst_ptr[off(c)]) * diff_sum;
+                ASSERT_NEAR(diff_src_ptr[off(c)], ref_diff,
+                        1e-5 * std::max(1., std::fabs(diff_sum)));
+            }
+        }
+    }
+
+    logsoftmax_test_params p;
+};
+
+TEST_P(logsoftmax_test, TestsLogSoftmax) {}
+
+CPU_INSTANTIATE_TEST_SUITE_P(TestLogSoftmax, logsoftmax_test,
+        ::testing::Values(
+            logsoftmax_test_params{memory::format_tag::nc, {2, 1000}, 1},
+            logsoftmax_test_params{memory::format_tag::nc, {13, 7}, 0},
+            logsoftmax_test_params{memory::format_tag::nc, {1, 13}, 1},
+            logsoftmax_test_params{memory::format_tag::nchw, {2, 19, 5, 7}, 1},
+            logsoftmax_test_params{memory::format_tag::nchw, {2, 19, 5, 7}, 3},
+            logsoftmax_test_params{memory::format_tag::nhwc, {2, 19, 5, 7}, 1},
+            logsoftmax_test_params{memory::format_tag::nChw8c,
+                    {2, 35, 3, 5}, 1},
+            logsoftmax_test_params{memory::format_tag::nChw16c,
+                    {2, 35, 3, 5}, 1},
+            logsoftmax_test_params{memory::format_tag::nchw,
+                    {2, 19, 4, 9}, 2}));
+
+TEST(logsoftmax_iface_test, TestsLogSoftmaxKind) {
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto md = memory::desc({2, 16}, memory::data_type::f32,
+            memory::format_tag::nc);
+
+    auto pd = logsoftmax_forward::primitive_desc(
+            {prop_kind::forward_inference, md, 1}, eng);
+    mkldnn_primitive_kind_t kind;
+    ASSERT_EQ(mkldnn_primitive_desc_query(pd.get(), mkldnn_query_primitive_kind,
+                      0, &kind), mkldnn_success);
+    ASSERT_EQ(kind, mkldnn_logsoftmax);
+
+    const mkldnn_logsoftmax_desc_t *d = nullptr;
+    ASSERT_EQ(mkldnn_primitive_desc_query(pd.get(), mkldnn_query_logsoftmax_d,
+                      0, &d), mkldnn_success);
+    ASSERT_EQ(d->primitive_kind, mkldnn_logsoftmax);
+    ASSERT_EQ(d->softmax_axis, 1);
+
+    /* a logsoftmax primitive must not be served for a softmax one */
+    auto softmax_pd = softmax_forward::primitive_desc(
+            {prop_kind::forward_inference, md, 1}, eng);
+    ASSERT_EQ(mkldnn_primitive_desc_query(softmax_pd.get(),
+                      mkldnn_query_primitive_kind, 0, &kind), mkldnn_success);
+    ASSERT_EQ(kind, mkldnn_softmax);
+}
+
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+class primitive_cache_test: public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        saved_capacity = get_primitive_cache_capacity();
+        set_primitive_cache_capacity(16);
+    }
+    virtual void TearDown() {
+        set_primitive_cache_capacity(saved_capacity);
+    }
+
+    memory::dim hits() {
+        memory::dim h, m;
+        get_primitive_cache_stats(h, m);
+        return h;
+    }
+
+    eltwise_forward::primitive_desc relu_pd(const engine &eng,
+            memory::dim n, float alpha = 0.f) {
+        memory::desc md({n, 16, 4, 4}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        auto d = eltwise_forward::desc(prop_kind::forward_inference,
+                algorithm::eltwise_relu, md, alpha);
+        return eltwise_forward::primitive_desc(d, eng);
+    }
+
+    int saved_capacity;
+};
+
+TEST_F(primitive_cache_test, TestHitAndMiss) {
+    engine eng(get_test_engine_kind(), 0);
+
+    memory::dim h0 = hits();
+    auto p0 = eltwise_forward(relu_pd(eng, 2));
+    ASSERT_EQ(hits(), h0);
+
+    auto p1 = eltwise_forward(relu_pd(eng, 2));
+    ASSERT_EQ(hits(), h0 + 1);
+    ASSERT_EQ(p0.get(), p1.get());
+
+    auto p2 = eltwise_forward(relu_pd(eng, 3));
+    auto p3 = eltwise_forward(relu_pd(eng, 2, 0.5f));
+    ASSERT_EQ(hits(), h0 + 1);
+    ASSERT_NE(p0.get(), p2.get());
+    ASSERT_NE(p0.get(), p3.get());
+}
+
+TEST_F(primitive_cache_test, TestSharedPrimitiveExecution) {
+    engine eng(get_test_engine_kind(), 0);
+    stream s(eng);
+
+    auto pd = relu_pd(eng, 2);
+    memory src(pd.src_desc(), eng), dst(pd.dst_desc(), eng);
+    {
+        auto p = eltwise_forward(pd);
+        (void)p;
+    } // the cache keeps the primitive alive after the user drops it
+
+    auto p = eltwise_forward(pd);
+    p.execute(s, {{MKLDNN_ARG_SRC, src}, {MKLDNN_ARG_DST, dst}});
+    s.wait();
+}
+
+TEST_F(primitive_cache_test, TestCapacity) {
+    engine eng(get_test_engine_kind(), 0);
+
+    set_primitive_cache_capacity(0);
+    ASSERT_EQ(get_primitive_cache_capacity(), 0);
+
+    memory::dim h0 = hits();
+    auto p0 = eltwise_forward(relu_pd(eng, 2));
+    auto p1 = eltwise_forward(relu_pd(eng, 2));
+    ASSERT_EQ(hits(), h0);
+    ASSERT_NE(p0.get(), p1.get());
+
+    set_primitive_cache_capacity(1);
+    auto p2 = eltwise_forward(relu_pd(eng, 2));
+    auto p3 = eltwise_forward(relu_pd(eng, 3)); // evicts the previous one
+    auto p4 = eltwise_forward(relu_pd(eng, 2));
+    ASSERT_EQ(hits(), h0);
+    ASSERT_NE(p2.get(), p4.get());
+
+    EXPECT_ANY_THROW(set_primitive_cache_capacity(-1));
+}
+
+}
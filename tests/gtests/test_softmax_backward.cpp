@@ -167,6 +167,9 @@ INSTANTIATE_TEST_SUITE_P(TestSoftmaxBackward, softmax_backward_test_float,
             softmax_bwd_test_params_float{ memory::format_tag::nc, memory::format_tag::nc, {16, 30000}, 1},
             softmax_bwd_test_params_float{ memory::format_tag::nc, memory::format_tag::nc, {2, 1000}, 1},
             softmax_bwd_test_params_float{ memory::format_tag::nChw8c, memory::format_tag::nChw8c, {64, 1011, 1, 1}, 1},
-            softmax_bwd_test_params_float{ memory::format_tag::nChw8c, memory::format_tag::nChw8c, {2, 1011, 32, 1}, 2}
+            softmax_bwd_test_params_float{ memory::format_tag::nChw8c, memory::format_tag::nChw8c, {2, 1011, 32, 1}, 2},
+            softmax_bwd_test_params_float{ memory::format_tag::nchw, memory::format_tag::nchw, {2, 19, 5, 7}, 1},
+            softmax_bwd_test_params_float{ memory::format_tag::nhwc, memory::format_tag::nhwc, {2, 19, 5, 7}, 1},
+            softmax_bwd_test_params_float{ memory::format_tag::nChw16c, memory::format_tag::nChw16c, {2, 35, 3, 5}, 1}
 ));
 }
@@ -228,7 +228,17 @@ INSTANTIATE_TEST_SUITE_P(TestSoftmaxForward, softmax_forward_test_float,
             softmax_fwd_test_params_float{prop_kind::forward_scoring,
             memory::format_tag::nChw8c, {64, 1011, 1, 1}, 1},
             softmax_fwd_test_params_float{prop_kind::forward_scoring,
-            memory::format_tag::nChw8c, {2, 1000, 32, 1}, 2}));
+            memory::format_tag::nChw8c, {2, 1000, 32, 1}, 2},
+            softmax_fwd_test_params_float{prop_kind::forward_scoring,
+            memory::format_tag::nchw, {2, 19, 5, 7}, 1},
+            softmax_fwd_test_params_float{prop_kind::forward_scoring,
+            memory::format_tag::nhwc, {2, 19, 5, 7}, 1},
+            softmax_fwd_test_params_float{prop_kind::forward_scoring,
+            memory::format_tag::nChw8c, {2, 1000, 3, 5}, 1},
+            softmax_fwd_test_params_float{prop_kind::forward_scoring,
+            memory::format_tag::nChw16c, {2, 19, 5, 7}, 1},
+            softmax_fwd_test_params_float{prop_kind::forward_scoring,
+            memory::format_tag::nChw16c, {2, 35, 3, 5}, 1}));
 
 TEST_P(softmax_forward_test_half, TestsSoftmax) { }
 GPU_INSTANTIATE_TEST_SUITE_P(TestSoftmaxForwardHalf, softmax_forward_test_half,
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+class async_stream_test: public ::testing::Test {
+protected:
+    eltwise_forward::primitive_desc linear_pd(const engine &eng, float alpha,
+            float beta) {
+        auto d = eltwise_forward::desc(prop_kind::forward_inference,
+                algorithm::eltwise_linear, md, alpha, beta);
+        return eltwise_forward::primitive_desc(d, eng);
+    }
+
+    memory::desc md = memory::desc({2, 16, 7, 7}, memory::data_type::f32,
+            memory::format_tag::nChw16c);
+    const memory::dim nelems = 2 * 16 * 7 * 7;
+};
+
+/* each primitive of the chain must see the results of the previous ones */
+CPU_TEST_F(async_stream_test, TestInOrderChain) {
+    engine eng(get_test_engine_kind(), 0);
+    stream s(eng, stream::flags::default_flags | stream::flags::async);
+
+    memory a(md, eng), b(md, eng);
+    {
+        auto a_ptr = map_memory<float>(a);
+        for (memory::dim i = 0; i < nelems; ++i)
+            a_ptr[i] = (float)(i % 13);
+    }
+
+    const int n_steps = 16;
+    for (int i = 0; i < n_steps; ++i) {
+        /* a = 2 * a + 1 and back, the primitives go away right after the
+         * submission */
+        eltwise_forward(linear_pd(eng, 2.f, 1.f)).execute(s,
+                {{MKLDNN_ARG_SRC, a}, {MKLDNN_ARG_DST, b}});
+        eltwise_forward(linear_pd(eng, 0.5f, -0.5f)).execute(s,
+                {{MKLDNN_ARG_SRC, b}, {MKLDNN_ARG_DST, a}});
+        eltwise_forward(linear_pd(eng, 1.f, 1.f)).execute(s,
+                {{MKLDNN_ARG_SRC, a}, {MKLDNN_ARG_DST, a}});
+    }
+    s.wait();
+
+    auto a_ptr = map_memory<float>(a);
+    for (memory::dim i = 0; i < nelems; ++i)
+        ASSERT_EQ(a_ptr[i], (float)(i % 13 + n_steps));
+}
+
+/* waiting on an idle stream, and destroying a busy one, are fine */
+CPU_TEST_F(async_stream_test, TestWaitAndDestroy) {
+    engine eng(get_test_engine_kind(), 0);
+
+    memory a(md, eng), b(md, eng);
+    fill_data<float>(nelems, a);
+    auto p = eltwise_forward(linear_pd(eng, 3.f, 0.f));
+    {
+        stream s(eng, stream::flags::default_flags | stream::flags::async);
+        s.wait();
+        p.execute(s, {{MKLDNN_ARG_SRC, a}, {MKLDNN_ARG_DST, b}});
+    } // the stream completes the submitted work before going away
+
+    auto a_ptr = map_memory<float>(a);
+    auto b_ptr = map_memory<float>(b);
+    for (memory::dim i = 0; i < nelems; ++i)
+        ASSERT_EQ(b_ptr[i], 3.f * a_ptr[i]);
+}
+
+}